@@ -42,16 +42,97 @@ typedef struct xobj_uint32
 	uint32_t **buf;
 } xobj_uint32;
 
+struct xobj_uint64;
+
+typedef void (*xobj_uint64_callback)(struct xobj_uint64*, size_t n);
+
+typedef struct xobj_uint64
+{
+	void *myobj;
+	xobj_uint64_callback callback;
+	size_t *n;
+	uint64_t **buf;
+} xobj_uint64;
+
 typedef xobj_uint32 x_random_device;
 typedef xobj_uint32 x_seed_seq_from;
 typedef xobj_uint32 x_seed_seq_from_delegate;
+
+typedef enum x_rng_type
+{
+	X_RNG_CALLBACK = 0,
+	X_RNG_PCG32,
+	X_RNG_PCG64,
+	X_RNG_MINSTD_RAND0,
+	X_RNG_MINSTD_RAND,
+	X_RNG_MT19937,
+	X_RNG_MT19937_64,
+	X_RNG_RANLUX24,
+	X_RNG_RANLUX48,
+	X_RNG_KNUTH_B,
+	X_RNG_PHILOX4X32,
+	X_RNG_THREEFRY4X64,
+	X_RNG_XOSHIRO256PP
+} x_rng_type;
+
+// rngs whose range fits in 32 bits are delegated through obj,
+// wider ones through obj64, which delivers one 64-bit word per draw
 typedef struct x_rng
 {
-	xobj_uint32 obj;
+	union {
+		xobj_uint32 obj;
+		xobj_uint64 obj64;
+	};
 	uint64_t min;
 	uint64_t max;
+	size_t block_len;
+	x_rng_type type;
+	// words the delegate has been handed but not yet used. they are
+	// kept from one call to the next, and dropped when the block
+	// length changes or the rng is moved with rng_advance, rng_seek
+	// or rng_split. block holds block_size words and is freed by
+	// rng_delete.
+	void *block;
+	size_t block_size;
+	size_t block_pos;
+	size_t block_avail;
+	// bits in the unit uniforms the distributions draw from this
+	// rng; 0 uses X_RANDOM_UNIFORM_BITS. see rng_setuniformbits.
+	int uniform_bits;
 } x_rng;
 
+//////////////////////////////////////////////////
+// thread safety
+//////////////////////////////////////////////////
+// the dist_<dist>_generate* and dist_sample* functions keep their
+// transient delegate state on the caller's stack, and write to the
+// x_rng struct only to save its block of unused words. they are
+// reentrant and may run on any number of threads at once, with these
+// caveats:
+//
+// - every draw advances the generator an x_rng wraps, and delegated
+//   draws move its block, so calls that share an x_rng must be
+//   serialized by the caller. give each thread its own x_rng
+//   instead; rng_split hands out non-overlapping substreams of one
+//   rng for this purpose.
+// - some distributions carry state from one draw to the next, so
+//   calls that share an x_dist must be serialized as well, and
+//   dist_<dist>_set_params must not run while the handle is being
+//   sampled.
+// - rng_setblocklen and rng_setuniformbits must not run while the
+//   x_rng is in use.
+// - an rng_delegate_callback runs on the calling thread and is passed
+//   a per-call copy of the x_rng, whose buf and n are only valid for
+//   the duration of the callback. it must not hold on to them. a
+//   buffer it (re)allocates into *buf must come from malloc or
+//   realloc, since it becomes the x_rng's block.
+// - the seeding objects (random_device, seed_seq_from and
+//   seed_seq_from_delegate) are not reentrant: serialize
+//   rng_<rng>_new calls that share a seed chain, or give each thread
+//   its own chain.
+// - everything else only reads its arguments or allocates and frees
+//   objects that the caller owns.
+
 //////////////////////////////////////////////////
 // random_device
 //////////////////////////////////////////////////
@@ -84,14 +165,88 @@ void seed_seq_from_delegate_setcontext(x_seed_seq_from_delegate *ssfd, void *con
 //////////////////////////////////////////////////
 // rngs
 //////////////////////////////////////////////////
+// RNG_DECL(pcg32, uint32_t) produces
+//
+// x_rng *rng_pcg32_new(x_seed_seq_from_delegate *ssfd);
+// void rng_pcg32_delete(x_rng *r);
+// uint32_t rng_pcg32_min(void);
+// uint32_t rng_pcg32_max(void);
+// uint32_t rng_pcg32_generate(x_rng *r);
+
+#define RNG_DECL(rng, rng_ret_type)					\
+	x_rng *rng_##rng##_new(x_seed_seq_from_delegate *ssfd);		\
+	void rng_##rng##_delete(x_rng *r);				\
+	rng_ret_type rng_##rng##_min(void);				\
+	rng_ret_type rng_##rng##_max(void);				\
+	rng_ret_type rng_##rng##_generate(x_rng *r)
+
 typedef struct rng_pcg32 rng_pcg32;
-x_rng *rng_pcg32_new(x_seed_seq_from_delegate *ssfd);
-void rng_pcg32_delete(x_rng *r);
-uint32_t rng_pcg32_min(void);
-uint32_t rng_pcg32_max(void);
-uint32_t rng_pcg32_generate(x_rng *r);
+RNG_DECL(pcg32, uint32_t);
+RNG_DECL(pcg64, uint64_t);
+RNG_DECL(minstd_rand0, uint32_t);
+RNG_DECL(minstd_rand, uint32_t);
+RNG_DECL(mt19937, uint32_t);
+RNG_DECL(mt19937_64, uint64_t);
+RNG_DECL(ranlux24, uint32_t);
+RNG_DECL(ranlux48, uint64_t);
+RNG_DECL(knuth_b, uint32_t);
+RNG_DECL(philox4x32, uint32_t);
+RNG_DECL(threefry4x64, uint64_t);
+RNG_DECL(xoshiro256pp, uint64_t);
+
+// these work with any of the rngs above
+void rng_delete(x_rng *r);
+uint64_t rng_generate(x_rng *r);
+// fills res with the next count words of r and returns it.
+// xoshiro256pp writes whole blocks at a time; the others loop.
+uint64_t *rng_generate_n(x_rng *r, uint64_t *res, long count);
 uint64_t rng_min(x_rng *r);
 uint64_t rng_max(x_rng *r);
+// number of words the rng delegate requests per callback (default 1).
+// words left over when a generate call returns are kept in the x_rng
+// for the next call, so a block length of K costs one callback per K
+// words however they are spread over calls. changing the block length
+// drops the words that are left.
+void rng_setblocklen(x_rng *r, size_t n);
+size_t rng_getblocklen(x_rng *r);
+// bits of resolution in the unit uniforms the distributions draw
+// from r (0, the default, uses X_RANDOM_UNIFORM_BITS, which is 53).
+// a number of bits that one word of r holds takes one word per
+// uniform, and more takes the full 53: 32 bit rngs hold 32 bits,
+// ranlux24 24, and minstd_rand0, minstd_rand and knuth_b 27, so
+// rng_setuniformbits(r, 32) halves the words a 32 bit rng spends,
+// at the cost of inverted tails that stop at about 2^-33. 64 bit
+// rngs always take one word.
+void rng_setuniformbits(x_rng *r, int bits);
+int rng_getuniformbits(x_rng *r);
+// advances r by delta draws. the counter based rngs (philox4x32 and
+// threefry4x64) do this in constant time, the pcg, minstd and
+// mersenne twister rngs in logarithmic time, and the others call
+// discard.
+void rng_advance(x_rng *r, uint64_t delta);
+// positions a counter based rng on draw index of stream, in constant
+// time. each stream holds 2^66 draws, and distinct streams never
+// overlap. returns r, or NULL, leaving r untouched, for other rngs.
+x_rng *rng_seek(x_rng *r, uint64_t stream, uint64_t index);
+// fills children[0..k-1] with new rngs of the same type as r, child i
+// starting i strides past r's current state, and leaves r k strides
+// past it. the streams do not overlap as long as no child (nor r)
+// draws more than one stride. the stride is 2^48 draws for pcg32,
+// 2^64 for pcg64, 2^24 for minstd_rand0 and minstd_rand, 2^128 for
+// mt19937 and mt19937_64, one stream (2^66 draws) for philox4x32 and
+// threefry4x64, and 2^192 draws per lane for xoshiro256pp. returns
+// children, or NULL, leaving r untouched, for ranlux24, ranlux48,
+// knuth_b and callback rngs, for minstd_rand0 and minstd_rand when
+// k > X_RNG_MINSTD_MAX_SPLIT, and for pcg32 when
+// k > X_RNG_PCG32_MAX_SPLIT: the minstd period is only 2^31 - 2 and
+// the pcg32 period 2^64, so more strides would wrap around onto the
+// first. free the children with rng_delete.
+#define X_RNG_MINSTD_MAX_SPLIT 126
+#define X_RNG_PCG32_MAX_SPLIT 65535
+x_rng **rng_split(x_rng *r, long k, x_rng **children);
+// the callback dist_<dist>_generate uses for r: def_rng_delegate_uint32_callback
+// for rngs with a 32-bit range, def_rng_delegate_uint64_callback otherwise
+xobj_uint32_callback rng_default_callback(x_rng *r);
 
 //////////////////////////////////////////////////
 // distributions
@@ -102,6 +257,13 @@ uint64_t rng_max(x_rng *r);
 //double dist_gamma_generate(void *context, xobj_uint32_callback callback, double alpha, double beta, uint64_t rng_min, uint64_t rng_max);
 
 //////////////////////////////////////////////////
+// when rng_max(rng) exceeds 0xFFFFFFFF, the rng_delegate_callback
+// passed to the functions below is called with &rng->obj64 and must
+// fill its buffer with 64-bit words; pass an xobj_uint64_callback
+// cast to xobj_uint32_callback. passing NULL samples rngs created
+// by the rng_<rng>_new functions directly, without a delegate;
+// the dist_<dist>_generate functions do this.
+//
 // these macros produce declarations of the form
 // <dist_ret_type> dist_<dist>_generate_with_callback(x_rng *rng,
 //                                                    xobj_uint32_callback rng_delegate_callback,
@@ -147,97 +309,380 @@ uint64_t rng_max(x_rng *r);
 	dist_ret_type dist_##dist##_generate(x_rng *rng,		\
 					     __VA_ARGS__)
 
+//////////////////////////////////////////////////
+// the _N_ variants produce bulk fill functions that construct the
+// distribution and wire up the rng delegate once, and then draw
+// count samples into res, which must have room for count values:
+//
+// <dist_ret_type> *dist_<dist>_generate_n_with_callback(x_rng *rng,
+//                                                      xobj_uint32_callback rng_delegate_callback,
+//                                                      <dist_ret_type> *res,
+//                                                      long count,
+//                                                      <arg1_type> <arg1_name>,
+//                                                      ...);
+//
+// <dist_ret_type> *dist_<dist>_generate_n(x_rng *rng,
+//                                        <dist_ret_type> *res,
+//                                        long count,
+//                                        <arg1_type> <arg1_name>,
+//                                        ...);
+//
+// both return res.
+
+#define DIST_GENERATE_N_WITH_CALLBACK_DECL(dist, dist_ret_type, ...) \
+	dist_ret_type *dist_##dist##_generate_n_with_callback(x_rng *rng, \
+							      xobj_uint32_callback rng_delegate_callback, \
+							      dist_ret_type *res, \
+							      long count, \
+							      __VA_ARGS__)
+
+#define DIST_GENERATE_N_DECL(dist, dist_ret_type, ...)\
+	dist_ret_type *dist_##dist##_generate_n(x_rng *rng,		\
+						dist_ret_type *res,	\
+						long count,		\
+						__VA_ARGS__)
+
+//////////////////////////////////////////////////
+// the _PARALLEL_ variant fills res on nthreads threads (0 means one
+// per core):
+//
+// <dist_ret_type> *dist_<dist>_generate_parallel(x_rng *rng,
+//                                               <dist_ret_type> *res,
+//                                               long count,
+//                                               long nthreads,
+//                                               <arg1_type> <arg1_name>,
+//                                               ...);
+//
+// res is cut into chunks of X_DIST_PARALLEL_CHUNK samples, and chunk
+// c is drawn with a fresh copy of the distribution from the rng
+// advanced c strides (see rng_split), so the output is the same for
+// every value of nthreads. rng is left one stride past the last
+// chunk. the output differs from that of dist_<dist>_generate_n,
+// which draws everything from a single stream. rngs that rng_split
+// refuses, minstd_rand0 and minstd_rand, whose period holds too
+// few strides for large tables, and pcg32 when res needs more than
+// X_RNG_PCG32_MAX_SPLIT chunks, are filled serially by
+// dist_<dist>_generate_n.
+
+#define X_DIST_PARALLEL_CHUNK (1L << 18)
+
+#define DIST_GENERATE_PARALLEL_DECL(dist, dist_ret_type, ...)	\
+	dist_ret_type *dist_##dist##_generate_parallel(x_rng *rng,	\
+						       dist_ret_type *res, \
+						       long count,	\
+						       long nthreads,	\
+						       __VA_ARGS__)
+
 DIST_GENERATE_WITH_CALLBACK_DECL(uniform_int, long, long a, long b);
 DIST_GENERATE_DECL(uniform_int, long, long a, long b);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(uniform_int, long, long a, long b);
+DIST_GENERATE_N_DECL(uniform_int, long, long a, long b);
+DIST_GENERATE_PARALLEL_DECL(uniform_int, long, long a, long b);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(uniform_real, double, double a, double b);
 DIST_GENERATE_DECL(uniform_real, double, double a, double b);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(uniform_real, double, double a, double b);
+DIST_GENERATE_N_DECL(uniform_real, double, double a, double b);
+DIST_GENERATE_PARALLEL_DECL(uniform_real, double, double a, double b);
 
 
 DIST_GENERATE_WITH_CALLBACK_DECL(bernoulli, long, double p);
 DIST_GENERATE_DECL(bernoulli, long, double p);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(bernoulli, long, double p);
+DIST_GENERATE_N_DECL(bernoulli, long, double p);
+DIST_GENERATE_PARALLEL_DECL(bernoulli, long, double p);
+// packs count trials into (count + 63) / 64 words, trial i in bit
+// i % 64 of res[i / 64]
+uint64_t *dist_bernoulli_generate_bits_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, uint64_t *res, long count, double p);
+uint64_t *dist_bernoulli_generate_bits(x_rng *rng, uint64_t *res, long count, double p);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(binomial, long, long t, double p);
 DIST_GENERATE_DECL(binomial, long, long t, double p);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(binomial, long, long t, double p);
+DIST_GENERATE_N_DECL(binomial, long, long t, double p);
+DIST_GENERATE_PARALLEL_DECL(binomial, long, long t, double p);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(geometric, long, double p);
 DIST_GENERATE_DECL(geometric, long, double p);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(geometric, long, double p);
+DIST_GENERATE_N_DECL(geometric, long, double p);
+DIST_GENERATE_PARALLEL_DECL(geometric, long, double p);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(negative_binomial, long, long t, double p);
 DIST_GENERATE_DECL(negative_binomial, long, long t, double p);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(negative_binomial, long, long t, double p);
+DIST_GENERATE_N_DECL(negative_binomial, long, long t, double p);
+DIST_GENERATE_PARALLEL_DECL(negative_binomial, long, long t, double p);
 
 // multinomial
 long *dist_multinomial_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long n, long buflen, double *p, long *res);
 long *dist_multinomial_generate(x_rng *rng, long n, long buflen, double *p, long *res);
+// res must have room for count * buflen values
+long *dist_multinomial_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long *res, long count, long n, long buflen, double *p);
+long *dist_multinomial_generate_n(x_rng *rng, long *res, long count, long n, long buflen, double *p);
+// writes the nonzero counts of one draw as index and count pairs and
+// returns how many there are; idx and counts must have room for
+// min(n, buflen) values
+long dist_multinomial_generate_sparse_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long n, long buflen, double *p, long *idx, long *counts);
+long dist_multinomial_generate_sparse(x_rng *rng, long n, long buflen, double *p, long *idx, long *counts);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(hypergeometric, long, long n, long M, long N);
 DIST_GENERATE_DECL(hypergeometric, long, long n, long M, long N);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(hypergeometric, long, long n, long M, long N);
+DIST_GENERATE_N_DECL(hypergeometric, long, long n, long M, long N);
+DIST_GENERATE_PARALLEL_DECL(hypergeometric, long, long n, long M, long N);
 
 // multivariate hypergeometric
 long *dist_multivariate_hypergeometric_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long n, long buflen, long *M, long *res);
 long *dist_multivariate_hypergeometric_generate(x_rng *rng, long n, long buflen, long *M, long *res);
+// res must have room for count * buflen values
+long *dist_multivariate_hypergeometric_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long *res, long count, long n, long buflen, long *M);
+long *dist_multivariate_hypergeometric_generate_n(x_rng *rng, long *res, long count, long n, long buflen, long *M);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(poisson, long, double mean);
 DIST_GENERATE_DECL(poisson, long, double mean);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(poisson, long, double mean);
+DIST_GENERATE_N_DECL(poisson, long, double mean);
+DIST_GENERATE_PARALLEL_DECL(poisson, long, double mean);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(exponential, double, double lambda);
 DIST_GENERATE_DECL(exponential, double, double lambda);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(exponential, double, double lambda);
+DIST_GENERATE_N_DECL(exponential, double, double lambda);
+DIST_GENERATE_PARALLEL_DECL(exponential, double, double lambda);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(gamma, double, double alpha, double beta);
 DIST_GENERATE_DECL(gamma, double, double alpha, double beta);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(gamma, double, double alpha, double beta);
+DIST_GENERATE_N_DECL(gamma, double, double alpha, double beta);
+DIST_GENERATE_PARALLEL_DECL(gamma, double, double alpha, double beta);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(weibull, double, double a, double b);
 DIST_GENERATE_DECL(weibull, double, double a, double b);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(weibull, double, double a, double b);
+DIST_GENERATE_N_DECL(weibull, double, double a, double b);
+DIST_GENERATE_PARALLEL_DECL(weibull, double, double a, double b);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(extreme_value, double, double a, double b);
 DIST_GENERATE_DECL(extreme_value, double, double a, double b);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(extreme_value, double, double a, double b);
+DIST_GENERATE_N_DECL(extreme_value, double, double a, double b);
+DIST_GENERATE_PARALLEL_DECL(extreme_value, double, double a, double b);
 
 // dirichlet
 double *dist_dirichlet_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long buflen, double *alpha, double *res);
 double *dist_dirichlet_generate(x_rng *rng, long buflen, double *alpha, double *res);
+// res must have room for count * buflen values
+double *dist_dirichlet_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count, long buflen, double *alpha);
+double *dist_dirichlet_generate_n(x_rng *rng, double *res, long count, long buflen, double *alpha);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(beta, double, double alpha, double beta);
 DIST_GENERATE_DECL(beta, double, double alpha, double beta);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(beta, double, double alpha, double beta);
+DIST_GENERATE_N_DECL(beta, double, double alpha, double beta);
+DIST_GENERATE_PARALLEL_DECL(beta, double, double alpha, double beta);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(kumaraswamy, double, double alpha, double beta);
 DIST_GENERATE_DECL(kumaraswamy, double, double alpha, double beta);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(kumaraswamy, double, double alpha, double beta);
+DIST_GENERATE_N_DECL(kumaraswamy, double, double alpha, double beta);
+DIST_GENERATE_PARALLEL_DECL(kumaraswamy, double, double alpha, double beta);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(laplace, double, double mu, double sigma);
 DIST_GENERATE_DECL(laplace, double, double mu, double sigma);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(laplace, double, double mu, double sigma);
+DIST_GENERATE_N_DECL(laplace, double, double mu, double sigma);
+DIST_GENERATE_PARALLEL_DECL(laplace, double, double mu, double sigma);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(erlang, double, long k, double lambda);
 DIST_GENERATE_DECL(erlang, double, double k, double lambda);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(erlang, double, long k, double lambda);
+DIST_GENERATE_N_DECL(erlang, double, long k, double lambda);
+DIST_GENERATE_PARALLEL_DECL(erlang, double, long k, double lambda);
+
+// table != 0 tabulates the inverse cdf of the tail, which takes about
+// 70us, so it pays off for generate_n and dist_gaussian_tail_new
+DIST_GENERATE_WITH_CALLBACK_DECL(gaussian_tail, double, double a, double sigma, int table);
+DIST_GENERATE_DECL(gaussian_tail, double, double a, double sigma, int table);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(gaussian_tail, double, double a, double sigma, int table);
+DIST_GENERATE_N_DECL(gaussian_tail, double, double a, double sigma, int table);
+DIST_GENERATE_PARALLEL_DECL(gaussian_tail, double, double a, double sigma, int table);
 
 
 DIST_GENERATE_WITH_CALLBACK_DECL(normal, double, double mean, double stddev);
 DIST_GENERATE_DECL(normal, double, double mean, double stddev);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(normal, double, double mean, double stddev);
+DIST_GENERATE_N_DECL(normal, double, double mean, double stddev);
+DIST_GENERATE_PARALLEL_DECL(normal, double, double mean, double stddev);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(lognormal, double, double m, double s);
 DIST_GENERATE_DECL(lognormal, double, double m, double s);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(lognormal, double, double m, double s);
+DIST_GENERATE_N_DECL(lognormal, double, double m, double s);
+DIST_GENERATE_PARALLEL_DECL(lognormal, double, double m, double s);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(chi_squared, double, double n);
 DIST_GENERATE_DECL(chi_squared, double, double n);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(chi_squared, double, double n);
+DIST_GENERATE_N_DECL(chi_squared, double, double n);
+DIST_GENERATE_PARALLEL_DECL(chi_squared, double, double n);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(cauchy, double, double a, double b);
 DIST_GENERATE_DECL(cauchy, double, double a, double b);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(cauchy, double, double a, double b);
+DIST_GENERATE_N_DECL(cauchy, double, double a, double b);
+DIST_GENERATE_PARALLEL_DECL(cauchy, double, double a, double b);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(fisher_f, double, double m, double n);
 DIST_GENERATE_DECL(fisher_f, double, double m, double n);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(fisher_f, double, double m, double n);
+DIST_GENERATE_N_DECL(fisher_f, double, double m, double n);
+DIST_GENERATE_PARALLEL_DECL(fisher_f, double, double m, double n);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(student_t, double, double n);
 DIST_GENERATE_DECL(student_t, double, double n);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(student_t, double, double n);
+DIST_GENERATE_N_DECL(student_t, double, double n);
+DIST_GENERATE_PARALLEL_DECL(student_t, double, double n);
 
 DIST_GENERATE_WITH_CALLBACK_DECL(rayleigh, double, double sigma);
 DIST_GENERATE_DECL(rayleigh, double, double sigma);
+DIST_GENERATE_N_WITH_CALLBACK_DECL(rayleigh, double, double sigma);
+DIST_GENERATE_N_DECL(rayleigh, double, double sigma);
+DIST_GENERATE_PARALLEL_DECL(rayleigh, double, double sigma);
 
 long dist_discrete_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long buflen, double *probabilities);
 long dist_discrete_generate(x_rng *rng, long buflen, double *probabilities);
+long *dist_discrete_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long *res, long count, long buflen, double *probabilities);
+long *dist_discrete_generate_n(x_rng *rng, long *res, long count, long buflen, double *probabilities);
+long *dist_discrete_generate_parallel(x_rng *rng, long *res, long count, long nthreads, long buflen, double *probabilities);
 
 double dist_piecewise_constant_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long intervals_len, double *intervals, double *densities);
 double dist_piecewise_constant_generate(x_rng *rng, long intervals_len, double *intervals, double *densities);
+double *dist_piecewise_constant_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count, long intervals_len, double *intervals, double *densities);
+double *dist_piecewise_constant_generate_n(x_rng *rng, double *res, long count, long intervals_len, double *intervals, double *densities);
+double *dist_piecewise_constant_generate_parallel(x_rng *rng, double *res, long count, long nthreads, long intervals_len, double *intervals, double *densities);
 
 double dist_piecewise_linear_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long intervals_len, double *intervals, double *densities);
 double dist_piecewise_linear_generate(x_rng *rng, long intervals_len, double *intervals, double *densities);
+double *dist_piecewise_linear_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count, long intervals_len, double *intervals, double *densities);
+double *dist_piecewise_linear_generate_n(x_rng *rng, double *res, long count, long intervals_len, double *intervals, double *densities);
+double *dist_piecewise_linear_generate_parallel(x_rng *rng, double *res, long count, long nthreads, long intervals_len, double *intervals, double *densities);
+
+//////////////////////////////////////////////////
+// distribution handles
+//////////////////////////////////////////////////
+// a handle keeps the distribution, and whatever it precomputes from
+// its parameters (the tables behind discrete, piecewise_constant and
+// piecewise_linear, for example), alive between calls.
+//
+// DIST_NEW_DECL(gamma, double alpha, double beta);
+// DIST_SET_PARAMS_DECL(gamma, double alpha, double beta);
+//
+// produce
+//
+// x_dist *dist_gamma_new(double alpha, double beta);
+// void dist_gamma_set_params(x_dist *d, double alpha, double beta);
+//
+// set_params must be called with a handle made by the matching
+// dist_<dist>_new. handles are sampled with the dist_sample functions,
+// which return integer valued distributions as doubles, and freed with
+// dist_delete.
+
+typedef struct x_dist x_dist;
+
+#define DIST_NEW_DECL(dist, ...)			\
+	x_dist *dist_##dist##_new(__VA_ARGS__)
+
+#define DIST_SET_PARAMS_DECL(dist, ...)				\
+	void dist_##dist##_set_params(x_dist *d, __VA_ARGS__)
+
+DIST_NEW_DECL(uniform_int, long a, long b);
+DIST_SET_PARAMS_DECL(uniform_int, long a, long b);
+
+DIST_NEW_DECL(uniform_real, double a, double b);
+DIST_SET_PARAMS_DECL(uniform_real, double a, double b);
+
+DIST_NEW_DECL(bernoulli, double p);
+DIST_SET_PARAMS_DECL(bernoulli, double p);
+
+DIST_NEW_DECL(binomial, long t, double p);
+DIST_SET_PARAMS_DECL(binomial, long t, double p);
+
+DIST_NEW_DECL(geometric, double p);
+DIST_SET_PARAMS_DECL(geometric, double p);
+
+DIST_NEW_DECL(negative_binomial, long t, double p);
+DIST_SET_PARAMS_DECL(negative_binomial, long t, double p);
+
+DIST_NEW_DECL(hypergeometric, long n, long M, long N);
+DIST_SET_PARAMS_DECL(hypergeometric, long n, long M, long N);
+
+DIST_NEW_DECL(poisson, double mean);
+DIST_SET_PARAMS_DECL(poisson, double mean);
+
+DIST_NEW_DECL(exponential, double lambda);
+DIST_SET_PARAMS_DECL(exponential, double lambda);
+
+DIST_NEW_DECL(gamma, double alpha, double beta);
+DIST_SET_PARAMS_DECL(gamma, double alpha, double beta);
+
+DIST_NEW_DECL(weibull, double a, double b);
+DIST_SET_PARAMS_DECL(weibull, double a, double b);
+
+DIST_NEW_DECL(extreme_value, double a, double b);
+DIST_SET_PARAMS_DECL(extreme_value, double a, double b);
+
+DIST_NEW_DECL(beta, double alpha, double beta);
+DIST_SET_PARAMS_DECL(beta, double alpha, double beta);
+
+DIST_NEW_DECL(kumaraswamy, double alpha, double beta);
+DIST_SET_PARAMS_DECL(kumaraswamy, double alpha, double beta);
+
+DIST_NEW_DECL(laplace, double mu, double sigma);
+DIST_SET_PARAMS_DECL(laplace, double mu, double sigma);
+
+DIST_NEW_DECL(erlang, long k, double lambda);
+DIST_SET_PARAMS_DECL(erlang, long k, double lambda);
+
+DIST_NEW_DECL(gaussian_tail, double a, double sigma, int table);
+DIST_SET_PARAMS_DECL(gaussian_tail, double a, double sigma, int table);
+
+DIST_NEW_DECL(normal, double mean, double stddev);
+DIST_SET_PARAMS_DECL(normal, double mean, double stddev);
+
+DIST_NEW_DECL(lognormal, double m, double s);
+DIST_SET_PARAMS_DECL(lognormal, double m, double s);
+
+DIST_NEW_DECL(chi_squared, double n);
+DIST_SET_PARAMS_DECL(chi_squared, double n);
+
+DIST_NEW_DECL(cauchy, double a, double b);
+DIST_SET_PARAMS_DECL(cauchy, double a, double b);
+
+DIST_NEW_DECL(fisher_f, double m, double n);
+DIST_SET_PARAMS_DECL(fisher_f, double m, double n);
+
+DIST_NEW_DECL(student_t, double n);
+DIST_SET_PARAMS_DECL(student_t, double n);
+
+DIST_NEW_DECL(rayleigh, double sigma);
+DIST_SET_PARAMS_DECL(rayleigh, double sigma);
+
+DIST_NEW_DECL(discrete, long buflen, double *probabilities);
+DIST_SET_PARAMS_DECL(discrete, long buflen, double *probabilities);
+
+DIST_NEW_DECL(piecewise_constant, long intervals_len, double *intervals, double *densities);
+DIST_SET_PARAMS_DECL(piecewise_constant, long intervals_len, double *intervals, double *densities);
+
+DIST_NEW_DECL(piecewise_linear, long intervals_len, double *intervals, double *densities);
+DIST_SET_PARAMS_DECL(piecewise_linear, long intervals_len, double *intervals, double *densities);
+
+void dist_delete(x_dist *d);
+double dist_sample_with_callback(x_dist *d, x_rng *rng, xobj_uint32_callback rng_delegate_callback);
+double dist_sample(x_dist *d, x_rng *rng);
+double *dist_sample_n_with_callback(x_dist *d, x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count);
+double *dist_sample_n(x_dist *d, x_rng *rng, double *res, long count);
 
 #ifdef __cplusplus
 }
@@ -48,6 +48,19 @@ typedef struct _maxobj
 	void *myobj;
 	t_atom **buf;
 	size_t *n;
+	long blocklen;
+	// atoms the rng delegate was sent but didn't use, kept for the
+	// next generate. they are dropped when blocklen or the
+	// generator's range changes.
+	t_atom *block;
+	size_t block_size;
+	size_t block_pos;
+	size_t block_avail;
+	uint64_t block_min;
+	uint64_t block_max;
+	// bits in the unit uniforms the samplers draw; 0 uses
+	// X_RANDOM_UNIFORM_BITS
+	long uniformbits;
 	int delegation_status;
 	t_critical lock;
     t_symbol *name;
@@ -62,6 +75,8 @@ namespace x
 	{
 		t_symbol *ps_generate = gensym("generate");
 		t_symbol *ps_paramnames = gensym("paramnames");
+		t_symbol *ps_blocklen = gensym("blocklen");
+		t_symbol *ps_uniformbits = gensym("uniformbits");
 		class obj
 		{
 		private:
@@ -86,6 +101,14 @@ namespace x
 				x->myobj = NULL;
 				x->buf = NULL;
 				x->n = NULL;
+				x->blocklen = 1;
+				x->block = NULL;
+				x->block_size = 0;
+				x->block_pos = 0;
+				x->block_avail = 0;
+				x->block_min = 0;
+				x->block_max = 0;
+				x->uniformbits = 0;
 				x->delegation_status = 0;
 				critical_new(&(x->lock));
 				return (t_object *)x;
@@ -740,6 +763,27 @@ namespace x
 		{
 			return _generator_knuth_b_obj.newobj(msg, argc, argv);
 		}
+
+		using generator_philox4x32_obj = rng_obj<x::random::philox4x32>;
+		generator_philox4x32_obj _generator_philox4x32_obj;
+		t_object *generator_philox4x32_newobj(t_symbol *msg, short argc, t_atom *argv)
+		{
+			return _generator_philox4x32_obj.newobj(msg, argc, argv);
+		}
+
+		using generator_threefry4x64_obj = rng_obj<x::random::threefry4x64>;
+		generator_threefry4x64_obj _generator_threefry4x64_obj;
+		t_object *generator_threefry4x64_newobj(t_symbol *msg, short argc, t_atom *argv)
+		{
+			return _generator_threefry4x64_obj.newobj(msg, argc, argv);
+		}
+
+		using generator_xoshiro256pp_obj = rng_obj<x::random::xoshiro256pp>;
+		generator_xoshiro256pp_obj _generator_xoshiro256pp_obj;
+		t_object *generator_xoshiro256pp_newobj(t_symbol *msg, short argc, t_atom *argv)
+		{
+			return _generator_xoshiro256pp_obj.newobj(msg, argc, argv);
+		}
 		
 		using rng_delegate_uint32 = x::proxy::delegate<uint32_t, t_atom, x::max::atom_get<uint32_t>, x::max::atom_set>;
 		using rng_delegate_uint64 = x::proxy::delegate<uint64_t, t_atom, x::max::atom_get<uint64_t>, x::max::atom_set>;
@@ -876,50 +920,99 @@ namespace x
 								o->setters[i](o, ac, av);
 							}
 						}
+						if(dictionary_hasentry(d, ps_blocklen)){
+							t_atom_long bl = 1;
+							dictionary_getlong(d, ps_blocklen, &bl);
+							xx->blocklen = bl > 0 ? bl : 1;
+						}
+						if(dictionary_hasentry(d, ps_uniformbits)){
+							t_atom_long ub = 0;
+							dictionary_getlong(d, ps_uniformbits, &ub);
+							xx->uniformbits = ub < 0 ? 0 : ub > 53 ? 53 : ub;
+						}
 						return x;
 					}
 					return NULL;
 				}
 
-				template <typename delegate_type>
-				void init_delegate(t_maxobj *_x, delegate_type *d)
+				// the delegate picks up the block of atoms left over from
+				// the last generate, and finalize_delegate takes back
+				// what it leaves
+				template <typename rng_type>
+				void init_delegate(t_maxobj *_x, rng_type *d)
 				{
 					d->context(outlet_delegation());
+					d->block_len(_x->blocklen);
+					d->buffer(_x->block);
+					d->buffer_len(_x->block_size);
+					d->resume(_x->block_pos, _x->block_avail);
 					_x->n = d->buffer_len_address();
 					_x->buf = d->buffer_address();
 				}
 
-				template <typename delegate_type>
-				void finalize_delegate(t_maxobj *_x, delegate_type *d)
+				template <typename rng_type>
+				void finalize_delegate(t_maxobj *_x, rng_type *d)
 				{
-					if(_x->buf){
-						if(*(_x->buf)){
-							sysmem_freeptr(*(_x->buf));
-						}
-					}
+					_x->block = d->buffer();
+					_x->block_size = d->buffer_len();
+					_x->block_pos = d->position();
+					_x->block_avail = d->available();
+					d->buffer(NULL);
+					d->buffer_len(0);
 					_x->buf = NULL;
 					_x->n = NULL;
 				}
 
+				// f is called with the delegate, wrapped in a
+				// uniform_bits_engine when uniformbits asks for other
+				// than the build's resolution, as rng_setuniformbits does
+				// for the c api
+				template <typename rng_type, typename F>
+				static void with_uniform_bits(t_maxobj *_x, rng_type &g, F f)
+				{
+					constexpr int w = x::random::__engine_bits<rng_type>();
+					if constexpr(w < 53){
+						long n = _x->uniformbits > 0 ? _x->uniformbits : X_RANDOM_UNIFORM_BITS;
+						if(n <= w){
+							x::random::uniform_bits_engine<w, rng_type> g1(g);
+							f(g1);
+						}else{
+							x::random::uniform_bits_engine<53, rng_type> g2(g);
+							f(g2);
+						}
+					}else{
+						f(g);
+					}
+				}
+
+				// draws against the stored parameters by reference, so a
+				// bang costs no copy of them (a discrete distribution's
+				// weights and alias table); the default constructed
+				// distribution only supplies the sampler
 				template <typename rng_type, bool U=multivariate>
-				static typename std::enable_if<!U>::type _generate(t_maxobj *_x, dist_type d, rng_type *rng)
+				static typename std::enable_if<!U>::type _generate(t_maxobj *_x, const typename dist_type::param_type& p, rng_type *rng)
 				{
+					dist_type d;
 					xcritical_enter(_x->lock);
-					((dist_obj<dist_type, result_type> *)(_x->myobj))->init_delegate(_x, (rng_delegate_uint64 *)rng);
+					((dist_obj<dist_type, result_type> *)(_x->myobj))->init_delegate(_x, rng);
 					t_atom a;
-					atom_set(&a, d(*rng));
+					with_uniform_bits(_x, *rng, [&](auto &g){atom_set(&a, d(g, p));});
                     xcritical_exit(_x->lock);
 					outlet_atoms(((dist_obj<dist_type, result_type> *)(_x->myobj))->outlet_main(), 1, &a);
                     xcritical_enter(_x->lock);
-					((dist_obj<dist_type, result_type> *)(_x->myobj))->finalize_delegate(_x, (rng_delegate_uint64 *)rng);
+					((dist_obj<dist_type, result_type> *)(_x->myobj))->finalize_delegate(_x, rng);
 					xcritical_exit(_x->lock);
 				}
 
 				template <typename rng_type, bool U=multivariate>
-				static typename std::enable_if<U>::type _generate(t_maxobj *_x, dist_type d, rng_type *rng)
+				static typename std::enable_if<U>::type _generate(t_maxobj *_x, const typename dist_type::param_type& p, rng_type *rng)
 				{
-					((dist_obj<dist_type, result_type> *)(_x->myobj))->init_delegate(_x, (rng_delegate_uint64 *)rng);
-					std::vector<result_type> vec = d(*rng);
+					dist_type d;
+					xcritical_enter(_x->lock);
+					((dist_obj<dist_type, result_type> *)(_x->myobj))->init_delegate(_x, rng);
+					std::vector<result_type> vec;
+					with_uniform_bits(_x, *rng, [&](auto &g){vec = d(g, p);});
+					xcritical_exit(_x->lock);
 					size_t n = vec.size();
 #ifndef __clang__
 					t_atom *a = (t_atom *)sysmem_newptr(sizeof(t_atom) * n);
@@ -930,7 +1023,9 @@ namespace x
 						atom_set(a + i, vec[i]);
 					}
 					outlet_atoms(((dist_obj<dist_type, result_type> *)(_x->myobj))->outlet_main(), n, a);
-					((dist_obj<dist_type, result_type> *)(_x->myobj))->finalize_delegate(_x, (rng_delegate_uint64 *)rng);
+					xcritical_enter(_x->lock);
+					((dist_obj<dist_type, result_type> *)(_x->myobj))->finalize_delegate(_x, rng);
+					xcritical_exit(_x->lock);
 #ifndef __clang__
 					sysmem_freeptr(a);
 #endif
@@ -939,7 +1034,7 @@ namespace x
 				static void generate(t_maxobj *_x, t_symbol *msg, short argc, t_atom *argv)
 				{
 					dist_obj<dist_type, result_type, multivariate, xparam_type> *x = (dist_obj<dist_type, result_type, multivariate, xparam_type> *)(_x->myobj);
-					dist_type d = dist_type(*((xparam_type *)x));
+					const typename dist_type::param_type& params = *((xparam_type *)x);
 					size_t n = 1;
                     t_atom mina, maxa;
                     uint64_t min, max;
@@ -958,6 +1053,13 @@ namespace x
 					outlet_anything(x->outlet_delegation(), _sym_max, 0, NULL);
                     xcritical_enter(_x->lock);
                     max = atom_getlong(&maxa);
+					if(min != _x->block_min || max != _x->block_max){
+						// a different generator: its words aren't ours
+						_x->block_pos = 0;
+						_x->block_avail = 0;
+						_x->block_min = min;
+						_x->block_max = max;
+					}
                     xcritical_exit(_x->lock);
 					// uint64_t min = atom_getlong(&mina);
 					// uint64_t max = atom_getlong(&maxa);
@@ -966,13 +1068,13 @@ namespace x
 						case 0:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 0, 0xFFFFFF> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						case 1:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 1, 0xFFFFFF> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						}
@@ -981,13 +1083,13 @@ namespace x
 						case 0:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 0, 0x7FFFFFFE> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						case 1:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 1, 0x7FFFFFFE> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						}
@@ -996,13 +1098,13 @@ namespace x
 						case 0:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 0, 0xFFFFFFFF> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						case 1:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 1, 0xFFFFFFFF> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						}
@@ -1011,13 +1113,13 @@ namespace x
 						case 0:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 0, 0xFFFFFFFFFFFF> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						case 1:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 1, 0xFFFFFFFFFFFF> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						}
@@ -1026,13 +1128,13 @@ namespace x
 						case 0:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 0, 0xFFFFFFFFFFFFFFFF> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						case 1:
 							{
 								x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 1, 0xFFFFFFFFFFFFFFFF> rng;
-								_generate(_x, d, &rng);
+								_generate(_x, params, &rng);
 							}
 							break;
 						}
@@ -1171,11 +1273,40 @@ namespace x
 					}
 				}
 
+				// the atoms left in the block were asked for with the old
+				// length, so they go
+				static t_max_err blocklen_set(t_maxobj *_x, t_object *attr, long argc, t_atom *argv)
+				{
+					if(argc && argv){
+						t_atom_long bl = atom_getlong(argv);
+						xcritical_enter(_x->lock);
+						_x->blocklen = bl > 0 ? bl : 1;
+						_x->block_pos = 0;
+						_x->block_avail = 0;
+						xcritical_exit(_x->lock);
+					}
+					return MAX_ERR_NONE;
+				}
+
+				static t_max_err uniformbits_set(t_maxobj *_x, t_object *attr, long argc, t_atom *argv)
+				{
+					if(argc && argv){
+						t_atom_long ub = atom_getlong(argv);
+						xcritical_enter(_x->lock);
+						_x->uniformbits = ub < 0 ? 0 : ub > 53 ? 53 : ub;
+						xcritical_exit(_x->lock);
+					}
+					return MAX_ERR_NONE;
+				}
+
 				static void freeobj(t_maxobj *x)
 				{
 					if(x->buf){
 						sysmem_freeptr(x->buf);
 					}
+					if(x->block){
+						sysmem_freeptr(x->block);
+					}
 					critical_free(x->lock);
 					if(x->myobj){
 						delete ((dist_obj<dist_type, result_type, multivariate, xparam_type> *)(x->myobj));
@@ -1189,7 +1320,9 @@ namespace x
 					for(int i = 0; i < x->nargs; i++){
 						if(name == x->names_sym[i]){
 							if(argc){
+								xcritical_enter(_x->lock);
 								x->setters[i](x, argc, argv);
+								xcritical_exit(_x->lock);
 							}else{
 								long ac = 0;
 								t_atom *av = NULL;
@@ -1223,7 +1356,9 @@ namespace x
 					t_symbol *name = (t_symbol *)object_method(attr, gensym("getname"));
 					for(int i = 0; i < ((xparam_type *)x)->nargs; i++){
 						if(!strcmp(name->s_name, x->names_sym[i]->s_name)){
+							xcritical_enter(_x->lock);
 							x->setters[i](x, argc, argv);
+							xcritical_exit(_x->lock);
 							break;
 						}
 					}
@@ -1279,6 +1414,11 @@ namespace x
 					class_addmethod(c, (method)max, "max", A_GIMME, 0);
 					class_addmethod(c, (method)paramnames, "paramnames", 0);
 					class_addmethod(c, (method)validparams, "validparams", 0);
+					// number of words requested from the generator per delegation
+					class_addattr(c, attr_offset_new("blocklen", _sym_long, 0, (method)0L, (method)blocklen_set, calcoffset(t_maxobj, blocklen)));
+					// bits in each unit uniform the samplers draw (0 for the
+					// default of 53); as many as one word holds take one word
+					class_addattr(c, attr_offset_new("uniformbits", _sym_long, 0, (method)0L, (method)uniformbits_set, calcoffset(t_maxobj, uniformbits)));
 					for(int i = 0; i < xparam_type::nargs; i++){
 						// class_addmethod(c, (method)param, xparam_type::names_str[i], A_GIMME, 0);
 						const std::string name = (std::string(xparam_type::names_str[i]));
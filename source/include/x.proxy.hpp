@@ -176,7 +176,9 @@ namespace x
 				delegate_type::operator()(callback, n);
 				if(delegate_type::buffer()){
 					typename delegate_type::boxed_type *buffer = delegate_type::buffer();
-					for(int i = 0; i < delegate_type::buffer_len(); i++){
+					// the buffer may be left over from a larger request
+					size_t len = delegate_type::buffer_len() < n ? delegate_type::buffer_len() : n;
+					for(size_t i = 0; i < len; i++){
 						start[i] = delegate_type::unbox(buffer + i);
 					}
 				}else{
@@ -192,22 +194,72 @@ namespace x
 			}
 		};
 
+		// rng_delegate asks its callback for block_len() words at a
+		// time and serves draws out of the buffer until it runs dry,
+		// so a block length of K costs one round trip per K draws.
+		// the buffer belongs to whoever binds it with buffer(); a
+		// delegate that is rebuilt for every call can carry the unused
+		// words over by saving position() and available() and handing
+		// them to resume() next time.
 		template <typename delegate_type, typename _result_type, _result_type MIN, _result_type MAX>
 		class rng_delegate : public delegate_type
 		{
+		private:
+			size_t _block_len = 1;
+			size_t _pos = 0;
+			size_t _avail = 0;
 		public:
 			typedef _result_type result_type;
 
 			static void callback(delegate_type*, size_t);
+
+			void block_len(size_t n)
+			{
+				_block_len = n > 0 ? n : 1;
+			}
+
+			size_t block_len(void)
+			{
+				return _block_len;
+			}
+
+			void flush(void)
+			{
+				_pos = 0;
+				_avail = 0;
+			}
+
+			void resume(size_t pos, size_t avail)
+			{
+				_pos = pos;
+				_avail = avail;
+			}
+
+			size_t position(void)
+			{
+				return _pos;
+			}
+
+			size_t available(void)
+			{
+				return _avail;
+			}
 			
 			result_type operator()()
 			{
-				delegate_type::operator()(callback, 1);
-				if(delegate_type::buffer() && delegate_type::buffer_len() > 0){
-					return delegate_type::unbox(delegate_type::buffer());
-				} else {
-					return 0;
+				if(_pos >= _avail){
+					delegate_type::operator()(callback, _block_len);
+					_pos = 0;
+					_avail = 0;
+					if(delegate_type::buffer()){
+						// the callback may hand back fewer words than we asked for
+						_avail = delegate_type::buffer_len() < _block_len ? delegate_type::buffer_len() : _block_len;
+					}
+					if(_avail == 0){
+						return 0;
+					}
 				}
+				return delegate_type::unbox(delegate_type::buffer() + _pos++);
 			}
 
 			static constexpr result_type min()
@@ -21,6 +21,21 @@ SOFTWARE.
 */
 
 #include "version.h"
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+// vector units used by the multi-lane engines
+#if defined(__AVX2__)
+#define X_RANDOM_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define X_RANDOM_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define X_RANDOM_NEON
+#include <arm_neon.h>
+#endif
 
 namespace pcg
 {
@@ -42,6 +57,741 @@ namespace x
 	constexpr char const* version = X_VERSION;
 	namespace random
 	{
+		// jump ahead for linear congruential engines with m < 2^32:
+		// x_{k+d} = A x_k + C mod m, where (A, C) is built by
+		// repeated squaring of the one step map (a, c). the engine
+		// doesn't expose its state, but one draw returns x_{k+1}, so
+		// the remaining d - 1 steps are taken from it and the result
+		// goes back in with seed
+		template <class _Engine>
+		void __lcg_advance(_Engine& __e, unsigned long long __delta)
+		{
+			if(!__delta){
+				return;
+			}
+			const unsigned long long __m = _Engine::modulus;
+			unsigned long long __x = __e() % __m;
+			__delta--;
+			unsigned long long __am = 1, __ac = 0;
+			unsigned long long __cm = _Engine::multiplier % __m, __cc = _Engine::increment % __m;
+			while(__delta){
+				if(__delta & 1){
+					__am = (__am * __cm) % __m;
+					__ac = (__ac * __cm + __cc) % __m;
+				}
+				__cc = ((__cm + 1) * __cc) % __m;
+				__cm = (__cm * __cm) % __m;
+				__delta >>= 1;
+			}
+			__e.seed(typename _Engine::result_type((__am * __x + __ac) % __m));
+		}
+
+		// the characteristic polynomial of a mersenne twister and x^(2^128)
+		// mod it, as __mt_jump::__pwords words, least significant first.
+		// they take most of a second to work out, so the two standard
+		// engines ship them; other parameterizations get null and
+		// __mt_jump computes them on first use.
+		template <class _Engine>
+		struct __mt_jump_tables
+		{
+			static const uint64_t *__charpoly(void) {return nullptr;}
+			static const uint64_t *__stride_base(void) {return nullptr;}
+		};
+
+		template <>
+		struct __mt_jump_tables<std::mt19937>
+		{
+			static const uint64_t *__charpoly(void)
+			{
+				static const uint64_t __t[] = {
+					0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000000000ULL,
+					0x0002000000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000008000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0020000000000000ULL, 0x0000002000000000ULL, 0x0000000080000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL, 0x0002000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000020ULL,
+					0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000010000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000200800ULL, 0x0000000000008000ULL,
+					0x0200000000000000ULL, 0x0100400000000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL,
+					0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL, 0x0000000000000021ULL,
+					0x4000000000000000ULL, 0x0000020000000000ULL, 0x0000010000000000ULL, 0x0000000020000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL,
+					0x0000800000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000000021000000ULL,
+					0x0000000000000000ULL, 0x0000000000001000ULL, 0x0800000000000002ULL, 0x0020000000000001ULL,
+					0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000840000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000020000ULL, 0x0800000000000042ULL, 0x0020000000000000ULL,
+					0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000000021000000ULL,
+					0x0000000000000000ULL, 0x0000000000000080ULL, 0x0000000000000002ULL, 0x0020000000000001ULL,
+					0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000002000ULL, 0x0000000000000080ULL, 0x0000000000000002ULL, 0x0021000000000000ULL,
+					0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000000001080000ULL,
+					0x0000000000002000ULL, 0x0000000000000000ULL, 0x0840000000000002ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000042000000ULL, 0x0000000000080000ULL,
+					0x0000000000002000ULL, 0x1000000000000000ULL, 0x0000000000000000ULL, 0x0021000000000000ULL,
+					0x0000000000000000ULL, 0x0000000080000000ULL, 0x0000000002000000ULL, 0x0000000001000000ULL,
+					0x0000000000002000ULL, 0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000002000000000ULL, 0x0000000080000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL,
+					0x0000000000002100ULL, 0x1000000000000000ULL, 0x0000000000000000ULL, 0x0001080000000000ULL,
+					0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000084000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0042000000000000ULL, 0x0000080000000000ULL,
+					0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+					0x0000000000000100ULL, 0x0080000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+					0x0000002000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x2000000000000000ULL, 0x0080000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+					0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+					0x2000000000000008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000200ULL,
+					0x0000000000000008ULL, 0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000008000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+					0x0000000000000000ULL
+				};
+				return __t;
+			}
+
+			static const uint64_t *__stride_base(void)
+			{
+				static const uint64_t __t[] = {
+					0xb5709ec472de3963ULL, 0xa823f8e588279bb6ULL, 0x041f225926d83e59ULL, 0x8b521777e7fdbb15ULL,
+					0xbf2812d548b5e756ULL, 0x0b4849aae4b0adb9ULL, 0xe96d39ce3e928b83ULL, 0x09eaf2e8af6131d3ULL,
+					0xc1814c7b33548456ULL, 0xfebd07bc893a7c83ULL, 0x5147dcbf01bd8267ULL, 0x9afef574e2a67de6ULL,
+					0xf0d3decab8334d09ULL, 0xd884703b5561fd58ULL, 0xb39b8f42ef5c803bULL, 0xd61cfed320dfb761ULL,
+					0x47416177cf5f3e5bULL, 0x8ea9cfab8e8442e9ULL, 0x60ddf78d585d0ec0ULL, 0xf0f7d60e2c9b8528ULL,
+					0xca3ee37db2bb3bfcULL, 0x870ed96981c9e659ULL, 0xce5248519573a0deULL, 0x73cda5ed77683b94ULL,
+					0xf43b956c56bcfcbcULL, 0xbf04b4001f91de14ULL, 0x1d8598319438c481ULL, 0x9d97aed5ca6ae0a2ULL,
+					0xe75c95199e464218ULL, 0xcd43455c253c5486ULL, 0x7f8282d473b5ccd8ULL, 0x192ddf99c8cacd44ULL,
+					0x5288b589d6be8546ULL, 0x9819557fb4f26ca7ULL, 0x03e73d28200570ebULL, 0x78a114c9264acc04ULL,
+					0x42eee89795f0fb7bULL, 0x67e751e8abcc80c2ULL, 0x140e87ef1330cc85ULL, 0xd3f8525e913b9a96ULL,
+					0x1ba1158f3ee3d205ULL, 0x1f6aa87d2c4cdb89ULL, 0x878b32239b5e9a3aULL, 0xa48c7778a498c3edULL,
+					0x1d08f055974ac066ULL, 0xd6de80e9c8a08242ULL, 0x2892ce4ca1cf0b40ULL, 0x604168ae842731c7ULL,
+					0xbecff8b2dd23ee6dULL, 0xa4369751dfac7287ULL, 0x4a5840d9ba8bc89dULL, 0xf53bdbeda7a58582ULL,
+					0xa4149d1ccfba4997ULL, 0xf2c72905d5c66fc3ULL, 0xae4d8e96ce68ad39ULL, 0xc588f396f213a9b5ULL,
+					0x2c618d4e9d6116bbULL, 0xebfb61f3b34420d1ULL, 0xcbdca6f23b702ed7ULL, 0xbe2833957cb78166ULL,
+					0x20c0d09603a2436aULL, 0xbf49b815e190aa6fULL, 0x9b45b90349d78dc3ULL, 0x67eb90e30aa4c4c8ULL,
+					0x7f5ceab1f32b13f0ULL, 0x641eaedbccc48294ULL, 0x80b553586d6aafb6ULL, 0xf1fa779a72b55832ULL,
+					0x8992aefd3b60af74ULL, 0x283594724fa609f2ULL, 0x527dc1a961e7aaf1ULL, 0xbcad693f834e8087ULL,
+					0x95171796c9ca3bf6ULL, 0xb7d367759f41164aULL, 0x5c77677bcf20cf3bULL, 0x47dfd69ff4765b01ULL,
+					0xd708247fd90d6e15ULL, 0xad7996285fe95113ULL, 0xfcfb0ce2c627f9f2ULL, 0x4b0033800f2441ceULL,
+					0x50fa780b72161100ULL, 0xb71ca8b71f72b11aULL, 0x5475baceffab42fdULL, 0x356eef7891c28b39ULL,
+					0xdc80086d1441c9c3ULL, 0xb5c30ec996c47491ULL, 0xa9321adda254e42dULL, 0xc30bee5b963a3612ULL,
+					0xdf141323635c75c7ULL, 0x8926e38f38308f58ULL, 0x897754d871b69592ULL, 0x5bc061743cddde5eULL,
+					0xbebb80a7ad520904ULL, 0xd91d5d335cc284d4ULL, 0x11090e418c6ba748ULL, 0x462cffbc33bb9929ULL,
+					0xefc68605c42a508eULL, 0x230e6cd9602a3a14ULL, 0x49b8eb3126c6f9f4ULL, 0x7c49e7a451bd358fULL,
+					0x1910bb3947b592cbULL, 0xad0ca5183ced6a5bULL, 0xd98ca57993461dcbULL, 0xecc5cb659526948eULL,
+					0x0bddc87dfd1a431bULL, 0x7d9820ac5d694024ULL, 0x716c1ae1ffeb5538ULL, 0x04f8ed8613cffb2fULL,
+					0x1b32eb97d777f039ULL, 0x893da4ee87c1a95fULL, 0x965118d4c235f16cULL, 0xf99023e2e87994baULL,
+					0x891268a5bb8c4545ULL, 0x4d163861e7cf46b4ULL, 0xca688c0e0b2c5681ULL, 0xb86346b536702e5fULL,
+					0x72a6013755e311bbULL, 0x47d10e13142fdc5cULL, 0xac088c30a34ce0cbULL, 0x4d79a2e88f9503feULL,
+					0x02b4c095937670c7ULL, 0x080533c020f8f5e0ULL, 0xab1d0c2581fe8f32ULL, 0xb601bb28048f776dULL,
+					0xf8b8e16e96004a47ULL, 0x4a9fa0426862af7bULL, 0x54384ad4b0b6f662ULL, 0x81670a57a350c0eeULL,
+					0x3a2c282026061dc1ULL, 0xb9749667b575f899ULL, 0xaa853838738dfc2aULL, 0xa53a92a400ccc442ULL,
+					0xbdc8cfa2cfaf5a3eULL, 0x529fee9d09884265ULL, 0x966c709ea4d7f84fULL, 0xd14265d44c80bc42ULL,
+					0xb23c2aedf5ebe7f3ULL, 0xb7d47c42804523f1ULL, 0x73370568a7cb0aa9ULL, 0x66158a1e06d90ac5ULL,
+					0xc4a3898c9805c7adULL, 0x7fc536907890addeULL, 0xc5427e0885c39b20ULL, 0x2fba05edc0c864f8ULL,
+					0x210ad2bfc365017aULL, 0x609ca0038ffb95eaULL, 0x84e663c48e6c4f72ULL, 0x753c1ca83c110562ULL,
+					0x48642afc8700b723ULL, 0xcef1123e14ac952cULL, 0xf075b8b8ed84973cULL, 0xf00a255a0ceac5c9ULL,
+					0x7e77e0dadfcd487cULL, 0x0071cb978be5750cULL, 0x28c4386f560827feULL, 0xbf6b3ad6af4049f0ULL,
+					0x2e3006d1a911aaddULL, 0x2e8489f95eb5bb74ULL, 0x84278164c36fb83dULL, 0x61e0e6be82302b47ULL,
+					0x11b59c560422260eULL, 0x9cd5ecaae4f20c9cULL, 0x9bc72523f866e2daULL, 0x816f533c52c41667ULL,
+					0xa0dbff9e47a3235eULL, 0xea9ca5a30c62a756ULL, 0xc51267e9de0761a6ULL, 0xf28b88663eed2af6ULL,
+					0xfd769663695ed01fULL, 0xbc47fcdf9065af4eULL, 0x424e389cdfca6259ULL, 0xbb03335e166c2c1bULL,
+					0xc4be33dd2a73a1a1ULL, 0x45746bc2e690d058ULL, 0x07d38d7f94b43407ULL, 0x74b851e460854fb3ULL,
+					0xd99df507db3d2ac2ULL, 0x5d6c254c86d3323bULL, 0xb4dd303282bfac22ULL, 0xb7261a5fb27e023bULL,
+					0x40f361bf34fe8179ULL, 0xe716500e6c9e7858ULL, 0x35c6ee0b65873b06ULL, 0xe4c5d4fcfb2864e7ULL,
+					0x858ee284281901c6ULL, 0x44803a65e5fca3cdULL, 0xf9f41e41f850f7f6ULL, 0x87cbf3c965eb5539ULL,
+					0xae056412be2f8074ULL, 0xd8fe916f3c5cb955ULL, 0xd18ccb5eaec289dfULL, 0x446157f20eef81bfULL,
+					0xde9821754690364aULL, 0xd094591bc1597ea0ULL, 0x79676e7ab1ed3e17ULL, 0xa283bdf6c495ebc1ULL,
+					0x6a06b25c648c3570ULL, 0x0deb138c398b0580ULL, 0x4e3d096ae51108edULL, 0xafde012b1dda7416ULL,
+					0xcb001892722f0317ULL, 0x82d756d223875cf7ULL, 0x2091ce44c99114deULL, 0x8a944ef9d24757b4ULL,
+					0xedf8f12b8594145aULL, 0xf30c0ce9998c4affULL, 0xba657a589ce601a0ULL, 0x94e6ec8d36a851ddULL,
+					0x86ada470ed46b938ULL, 0x46c714b9409b507dULL, 0xb628043e05c862a8ULL, 0x8d763a8c7ac4a188ULL,
+					0x7f5ba7970adc18b6ULL, 0x5db4bc6b69073599ULL, 0x3d087e22444d59d3ULL, 0x61466f51e9c04e89ULL,
+					0x151fd405548aa4e6ULL, 0x6090566191555389ULL, 0x3e3c85615e8d5619ULL, 0x2491156c39c6b81cULL,
+					0x17b4d42cfc2fd4a6ULL, 0x2bd704cf82c9bcf9ULL, 0x054032407b2568ecULL, 0x7e037b6b5d2268d9ULL,
+					0x231f10e7d86bec7aULL, 0x964f8501ba016830ULL, 0x9873c321a3b7321fULL, 0xa5a250e1350ac2ddULL,
+					0xc738d24726578385ULL, 0xcd33873c012541caULL, 0xd0cdc82cc5907f19ULL, 0x5656cca45c2b540aULL,
+					0xa3d987b81f887dd1ULL, 0x06a2847883e7fe48ULL, 0x465f2df8945682dbULL, 0xfac8ffbc9b494ce1ULL,
+					0xb12ac825598f39cdULL, 0x3e5c217efa99231bULL, 0xe550fdba3b2d8ba2ULL, 0x846a67338e510006ULL,
+					0xee48a9263e573194ULL, 0x41c394c85ccd36bdULL, 0xa19b67f210a79620ULL, 0x8a285c068b3fd2a6ULL,
+					0x3637050a3a1797d9ULL, 0x7295647e63dfca07ULL, 0xbe8e76017a7b3bbaULL, 0x3c1e511aea660549ULL,
+					0x06c40c25c7a1931aULL, 0x7d1886643796cf70ULL, 0xb9f70031ccd9fa38ULL, 0x87fe9735601e2c75ULL,
+					0xef645dd6f8cd68b0ULL, 0x535d71387d05b323ULL, 0x90327a265c02f47fULL, 0xabd5ea2563ecd3b2ULL,
+					0x302c164101624325ULL, 0x1cdfa6bcdbfbeb93ULL, 0xb15987ed866519a2ULL, 0x0c31ec84113296f1ULL,
+					0xb4132090232a35b2ULL, 0x535172e392d0c3c5ULL, 0xfc24a0a9095ffccbULL, 0x2546326e932c038eULL,
+					0x1bbafc54ccc15e47ULL, 0xa84866303cf2a838ULL, 0x8405b4ae1057e025ULL, 0x1eec4c73da36738dULL,
+					0x4f9ff10488b30f90ULL, 0x6eab7da885eea780ULL, 0x6fe9593d40d9fdbeULL, 0x65606c0c3c850d3cULL,
+					0x70308a34b078a231ULL, 0x6d9a7cbe635af9bdULL, 0x63660519ed73ee32ULL, 0x0e62955f1701dd8dULL,
+					0x9cb66a13180db0e9ULL, 0x78fb88aad3c2cd3eULL, 0xa2859c5285fdbe48ULL, 0x902ffd419579f8f8ULL,
+					0x1f5e048a4b7c6a7bULL, 0x706d24958e262d89ULL, 0x816d7f42ebbbd878ULL, 0x3e6cc58a88cdfbf1ULL,
+					0xaa7dfafd754a64abULL, 0xb63cd2f7e98d0a02ULL, 0x72c5b57f38c8c85cULL, 0xe479da34b97f2b0aULL,
+					0x7c86232a553e33f7ULL, 0xedc6266db35cc8f8ULL, 0x14b7f688ca67e7feULL, 0xb3d3d66f072d997bULL,
+					0x121005b9528c6a42ULL, 0x87d31f390df2b622ULL, 0xedaedb3712ce5fd4ULL, 0x8e53ff2549dec2f4ULL,
+					0x764041aae79e435aULL, 0xb359bd5e29a3ee70ULL, 0x303acd045aa2b047ULL, 0x165795c2b82a2d07ULL,
+					0x950faac1a64ab733ULL, 0xff195e03dfa2861fULL, 0x5eb360ec8cd6e865ULL, 0x19e1a74d639cb063ULL,
+					0x775c20d67ec12528ULL, 0x08722d7fa44c4ddfULL, 0x83d145bcb0c92d32ULL, 0x73da60e43b2207e8ULL,
+					0x962813b9a13d0929ULL, 0xeb6572d6738f420bULL, 0x80a4a0ef151a52caULL, 0x0000000023eee457ULL,
+					0x0000000000000000ULL
+				};
+				return __t;
+			}
+		};
+
+		template <>
+		struct __mt_jump_tables<std::mt19937_64>
+		{
+			static const uint64_t *__charpoly(void)
+			{
+				static const uint64_t __t[] = {
+					0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0100000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000100000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000100000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL,
+					0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL, 0x0100000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0001000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000001000ULL,
+					0x0000000000000000ULL, 0x0000010000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x1000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL, 0x0001a00000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000010ULL,
+					0x0000000000000000ULL, 0x0000000124000000ULL, 0x0000000000000000ULL, 0x1050000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001058000ULL, 0x0000000000000000ULL,
+					0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000010480ULL,
+					0x0000000000000000ULL, 0x0000004100000000ULL, 0x0000000000000000ULL, 0x1800000000000000ULL,
+					0x0000000000000104ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0008000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010110000ULL,
+					0x0000000000000000ULL, 0x0001980000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000100004ULL, 0x0000000000000000ULL, 0x0001008860000000ULL, 0x0000000000000000ULL,
+					0x0400000000000000ULL, 0x0000000000001001ULL, 0x0000000000000000ULL, 0x0000000018400000ULL,
+					0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000082600ULL, 0x0000000000000000ULL, 0x0001005000000000ULL, 0x0000000000000000ULL,
+					0x8000000000000000ULL, 0x0000000001001805ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+					0x0000000000000000ULL, 0x04a0000000000000ULL, 0x0000000000010008ULL, 0x0000000000000000ULL,
+					0x0000000000400000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000022600000000ULL,
+					0x0000000000000001ULL, 0x4000000000000000ULL, 0x0000000000000010ULL, 0x0000000000000000ULL,
+					0x0080000184000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000004ULL,
+					0x0000000000000000ULL, 0x0000a00060a40000ULL, 0x0000000000000000ULL, 0x0400400000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400400ULL, 0x0000000000000000ULL,
+					0x4000404000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000024002624ULL,
+					0x0000000000000000ULL, 0x0050005040000000ULL, 0x0000000000000000ULL, 0x8400000000000000ULL,
+					0x0000000000058005ULL, 0x0000000000000000ULL, 0x0000400040400000ULL, 0x0000000000000000ULL,
+					0x04a4000000000000ULL, 0x0000000000000480ULL, 0x0000000000000000ULL, 0x0000004100404000ULL,
+					0x0000000000000000ULL, 0x1804040000000000ULL, 0x0000000000000004ULL, 0x0000000000000000ULL,
+					0x0000000000000040ULL, 0x0000000000000000ULL, 0x0008022400000000ULL, 0x0000000000000000ULL,
+					0x4000000000000000ULL, 0x0000000000110010ULL, 0x0000000000000000ULL, 0x0001980184000000ULL,
+					0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000004ULL, 0x0000000000000000ULL,
+					0x0000008860a40000ULL, 0x0000000000000000ULL, 0x0400400000000000ULL, 0x0000000000000001ULL,
+					0x0000000000000000ULL, 0x0000000018400400ULL, 0x0000000000000000ULL, 0x0000404000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000082624ULL, 0x0000000000000000ULL,
+					0x0001005040000000ULL, 0x0000000000000000ULL, 0x8400000000000000ULL, 0x0000000000001805ULL,
+					0x0000000000000000ULL, 0x0000000040400000ULL, 0x0000000000000000ULL, 0x04a4000000000000ULL,
+					0x0000000000000008ULL, 0x0000000000000000ULL, 0x0000000000404000ULL, 0x0000000000000000ULL,
+					0x0004040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000040ULL,
+					0x0000000000000000ULL, 0x0000022400000000ULL, 0x0000000000000000ULL, 0x4000000000000000ULL,
+					0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000184000000ULL, 0x0000000000000000ULL,
+					0x0040000000000000ULL, 0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000060a40000ULL,
+					0x0000000000000000ULL, 0x0400400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000400400ULL, 0x0000000000000000ULL, 0x0000404000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000002624ULL, 0x0000000000000000ULL, 0x0000005040000000ULL,
+					0x0000000000000000ULL, 0x8400000000000000ULL, 0x0000000000000005ULL, 0x0000000000000000ULL,
+					0x0000000040400000ULL, 0x0000000000000000ULL, 0x04a4000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000404000ULL, 0x0000000000000000ULL, 0x0004040000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+					0x0000022400000000ULL, 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000010ULL,
+					0x0000000000000000ULL, 0x0000000184000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000a40000ULL, 0x0000000000000000ULL,
+					0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+					0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000024ULL, 0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+					0x0400000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+					0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+					0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL,
+					0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+					0x0000000000000000ULL
+				};
+				return __t;
+			}
+
+			static const uint64_t *__stride_base(void)
+			{
+				static const uint64_t __t[] = {
+					0x153fbc23409b1e30ULL, 0xb8d58a2efc1cc7beULL, 0x04cc8df6bd5573e1ULL, 0x8e1b99d6ea322754ULL,
+					0x7fa5c8ab11a78ecfULL, 0xa3f01992f879dc26ULL, 0x77500e62929d74d1ULL, 0x4c65ef439f2dcb2aULL,
+					0x731b3bd3538eec46ULL, 0x14cd564c40c9e3aeULL, 0x6ff65677752268b7ULL, 0xbbea104c48ec8b8dULL,
+					0x08d3565972568ea4ULL, 0x5cb79db1f77395f2ULL, 0x94f5c348a32cecacULL, 0x4b58cc38b6123ed7ULL,
+					0x64d191a00b3e362cULL, 0x7b051615bc105659ULL, 0x2ad11e2d812e15d2ULL, 0xd2551d15c944f218ULL,
+					0x68374254d1f46885ULL, 0x72a5fd7700e8c34fULL, 0xe40b4ac61e14376cULL, 0xbb107cd0a9158cc0ULL,
+					0x5028a2a3d4ce28e6ULL, 0xd0815eeb2e91aa05ULL, 0x29ba386f6309e7ddULL, 0xa19bf128091df643ULL,
+					0xa4dda3ea5af247f8ULL, 0x950ff2c8bc8d9f30ULL, 0xc415a0871ef1af4eULL, 0xe8859d7a5ac3264cULL,
+					0x4d58e6bed0739fe2ULL, 0xb072d474e3f9602cULL, 0x93b112035cf0e33dULL, 0x90d4af56420a0a3dULL,
+					0xcb930cdffd09ba87ULL, 0x82305413c76ba04aULL, 0x88ed61ba7dfc9075ULL, 0xdefc75a7869c145cULL,
+					0x0c16916696775659ULL, 0x94a47bf0b5d3869bULL, 0x026c4476e2551799ULL, 0x2b22d90027fdd747ULL,
+					0xe447af7718644777ULL, 0xbb83f1c03190e0faULL, 0x932fabc717b3114cULL, 0xe0384041dbd5eafdULL,
+					0x698ca9a2304fa895ULL, 0xbbb26eff4e2f6627ULL, 0x453cab967a470645ULL, 0x2a6aefabcd19d4e9ULL,
+					0x808f8d33240f6b90ULL, 0x91bf46c93a4b852bULL, 0x74b6a8597100e697ULL, 0xbd2a4ef239564089ULL,
+					0x9917718e08ec24faULL, 0xac9ce650dccc5d61ULL, 0x52db4d76a2c5546cULL, 0x0123e0fc3cb90aeaULL,
+					0xfe78f1e83bb93635ULL, 0x4f5b739d5ba04851ULL, 0xa4bf7f96e9684a89ULL, 0x5464bb377a97f62eULL,
+					0x328933f006ce14beULL, 0x43e558b7d62ae5d7ULL, 0xddb0f33f21e7d8dcULL, 0x52d2779de93320d2ULL,
+					0x57191c72acfc5093ULL, 0x1779384819ca00e9ULL, 0x7afcfbbe2acaa684ULL, 0x90231d57884a7544ULL,
+					0xdd3ffead4feec6e3ULL, 0x273584a42f1a795dULL, 0x691601338d2c7449ULL, 0x8c8e419ca0529fc3ULL,
+					0x373e37dd051f8b86ULL, 0x27a2d7161f6d06bdULL, 0x954240070472311aULL, 0x471565b60a93d2e4ULL,
+					0x4fb4ad962c328135ULL, 0x7b1a3a92c401e93bULL, 0xf261c3fcc82af141ULL, 0x57241af08978f3ecULL,
+					0x2c79aaa370d1bd4fULL, 0xf35790a0978137d6ULL, 0x38c7263c96234239ULL, 0xe0a13a1dd5f852b5ULL,
+					0x0734f6c962f86802ULL, 0xca52564f72f13f11ULL, 0xa4bd2a9dc69a1248ULL, 0x6f418a04edb45e98ULL,
+					0x764b57a0059aa71aULL, 0x926f6f5f354266dfULL, 0x60c4150013cc9412ULL, 0x3a14980c9d4ccd96ULL,
+					0x4e5da33944239d8bULL, 0x23f3ef6e843c729cULL, 0x389b1022de0ac7c9ULL, 0x369b29d7d285823eULL,
+					0xf556214ad63e2cd9ULL, 0x90e43b9536bc15abULL, 0xa43604007e23fd84ULL, 0x70ee2bd8d9e6c2afULL,
+					0x0e8b6c7a77fd426aULL, 0xed09417ce0d73cdfULL, 0xa3e935e2c81a4021ULL, 0x7cf2e08b288398faULL,
+					0x1e933cde96a31115ULL, 0xdb6014c3a780c561ULL, 0x2bf15950b4660f9dULL, 0x50cf62efc80a3c55ULL,
+					0x448ede02ea0783c5ULL, 0x97df0d14f64c01c7ULL, 0x1353357d543368d0ULL, 0x9bd1449652cdca9cULL,
+					0x66d15aefa7a24321ULL, 0x25dd75fc7492ba9dULL, 0x468ce9a1a3874e13ULL, 0x40ab9e8ed67a4ad1ULL,
+					0x0bafb4d323d02677ULL, 0xf9f3d01c1f435b69ULL, 0x0c4a0fa46fac656aULL, 0xbdac3abdd37e4dfcULL,
+					0xdf9b06ef05db31dfULL, 0xed005f00f37daa7bULL, 0x924be2e465b09410ULL, 0x99099376ea87be57ULL,
+					0x302d8a7c49c4be6aULL, 0xe8effc70541c07a5ULL, 0x6e4611ad196a6ee3ULL, 0xbd42cb15a52cb228ULL,
+					0xce343ee493cdec20ULL, 0x7f4231e3d20e8e72ULL, 0xa2127d2ed81e4f89ULL, 0x27bb32afa1c6ef4cULL,
+					0x9d37d9f4cb87c492ULL, 0xa6b7e94b15e2287cULL, 0x098b4d302e16d6e9ULL, 0x12d1da8ffbf3adb2ULL,
+					0xd5be155bc2fc01deULL, 0x90f630b9e309715bULL, 0xbdb108b0f8da213cULL, 0x98ed520d71f49d1aULL,
+					0x82495aacd19eb9dcULL, 0x124d7478a15025b2ULL, 0xa0eb607ec4087775ULL, 0xcb47955eeabe0890ULL,
+					0x7360a3d0e0b68b89ULL, 0x25f5bee656159d92ULL, 0xeae8434e13f985edULL, 0x04ff38722ad10a86ULL,
+					0xac7097215b434280ULL, 0x3640ae9dd0687b1aULL, 0xb24209a4ce9f603bULL, 0xf03e6fd6f7a416ddULL,
+					0xd31e5bcde48672afULL, 0x2704ce60eb8429a7ULL, 0xf7aeb81f8fcd00c3ULL, 0x5424dbaa0b636a3cULL,
+					0xf352fe250d625a64ULL, 0x9cc12556c2228f86ULL, 0xedac0dbb94e94f51ULL, 0xdd8f2b1f26762fd1ULL,
+					0x5ef488076c7e957fULL, 0x2b734dc8a46c3c61ULL, 0x52111589eb2a22e3ULL, 0xfa11c9bb843df4bcULL,
+					0x5896ac2ecf36f9d2ULL, 0x66c197a7e49dba0aULL, 0xe1eda2cd47aefd0fULL, 0x4cae0acf5d5fa62dULL,
+					0xcb3e21e3f8d7c943ULL, 0x351580d27b75fe44ULL, 0x6cbd4b5618cbab9bULL, 0x8e47ef0542e8a51dULL,
+					0x125adf6b4b59b2efULL, 0x2729dc334cacfd5bULL, 0x883432a737937820ULL, 0x60f002c1dceda4abULL,
+					0xafed1be46e7fd2bcULL, 0xf2a3d1ccbf871115ULL, 0xf85e5c5050ae7160ULL, 0x777cdc44554e6d74ULL,
+					0x0bcf75213e259946ULL, 0x9d0714b4db9ca29aULL, 0x370fdc4067326a6dULL, 0xffeb713807a1cea8ULL,
+					0x7fb0a9674a53e792ULL, 0x62b040005f9ce7bbULL, 0x8903f6b282b67cabULL, 0x3544ff158026eb52ULL,
+					0xd66590248adf92f1ULL, 0x55de1c87a2ebdf48ULL, 0x40b0382287267abaULL, 0x7dfa56a6fb26180eULL,
+					0x45c32d7dc66b19ceULL, 0xf5ed0edf665034c7ULL, 0xf4c7adbe75e15da0ULL, 0x95db8535e0bd9122ULL,
+					0xc571b09620d82713ULL, 0x9c21ed0e78f021f9ULL, 0xd0cb50a9f9aa8defULL, 0xbcb3368c4e9ff5b6ULL,
+					0x06d8f649704939a3ULL, 0x5eaa9ee186d14a54ULL, 0x86d1f972fd4883d0ULL, 0x63b1522f4d50d887ULL,
+					0x982b2fba1a9875a7ULL, 0x7258bfd6235930eaULL, 0xe4ccc8e3c2f0f70eULL, 0x9bf390d119769362ULL,
+					0x1bcea29dbd2c02beULL, 0xd9c189db413398c0ULL, 0x988aa44564f85434ULL, 0x007ed1eaeef5e20aULL,
+					0xa0685fede0eec596ULL, 0xfef177e0b35a7f0eULL, 0x5006596f191ebc61ULL, 0xcba87c3e61bdbc8aULL,
+					0xff2174049069bfcbULL, 0xd7a536ddb2c4f33fULL, 0xf7aecde21fc2d977ULL, 0xc121dca3feef7800ULL,
+					0xa90ad927d025c16bULL, 0x3ea6fee532058e96ULL, 0x9f5210df30acdeb9ULL, 0x520e94889837bcffULL,
+					0x8c6c6a100dabdb5bULL, 0x6d2101f3fc530774ULL, 0x51d535e6dc645e49ULL, 0xe5e7620ed6a4941bULL,
+					0xaf8023c107046243ULL, 0x62e6e40f4ea19600ULL, 0x466396ce1ab8e939ULL, 0x470fc344d01a2a69ULL,
+					0x223011f816549f0eULL, 0x9b0a401733299c57ULL, 0x6e214523ae60b334ULL, 0x84c4cbe45a9b66a6ULL,
+					0x630d39f922b4c0b4ULL, 0xfbfa79ec2c0e1012ULL, 0xe9940485ec80d5c0ULL, 0x1dc1c6fb5a01f32aULL,
+					0x9cd0b7f3a578e57fULL, 0x40b6ce9d50e92c04ULL, 0x588b8af39ab91d81ULL, 0x8058dc2783b02de3ULL,
+					0xbb2103c504392c9dULL, 0x7264692220716211ULL, 0xdb804fcdeb987bbaULL, 0xababd32a49398687ULL,
+					0xe3dee3755b4da875ULL, 0x16de733adb8bb721ULL, 0x99476d13103ffe32ULL, 0x86d2d629666cb05bULL,
+					0x9c4e62ab740ce645ULL, 0xb59682265b7519ffULL, 0x54df6930e9ed43fbULL, 0x33f8218861f98b68ULL,
+					0x21bc749542f06516ULL, 0xd5e9662b4586df7fULL, 0x465569ea0eb5cce4ULL, 0x36a484c938f0ae75ULL,
+					0xc088cc5189f80399ULL, 0x4becd1a8a2280cdeULL, 0x192f20a74dac06f0ULL, 0xae766a8b287a1565ULL,
+					0x036c05ba6abff5f3ULL, 0x5fe448493d8faf69ULL, 0xa880a8ff94b90ea8ULL, 0xd0ec7c6342d2b77bULL,
+					0xd187d7068a2cf90fULL, 0x32523f9ad82e6693ULL, 0x0f87420e87b90726ULL, 0x3a745f953d8e0c35ULL,
+					0x0199993c5a3d1db4ULL, 0x33e45b5766ccb1a0ULL, 0xd2abaac1626e0b0cULL, 0xad5c3023b061fdfbULL,
+					0xf67cf6541cb66e52ULL, 0xe9d9083c635a2190ULL, 0x29a103e0c3b4dac8ULL, 0x75f72adb5e7a7e46ULL,
+					0xdcc943ab2ec296daULL, 0x396a079f137ff14bULL, 0x67853f3d29182ec1ULL, 0x35dd3e7a7a71c780ULL,
+					0xfbf82a6fa275a546ULL, 0x39cc58a7583f7227ULL, 0x8b1b1aedefea9fedULL, 0x909f457dada71450ULL,
+					0xc02abfcbfe3e387aULL, 0xd6871e18b79ae3c1ULL, 0x9f6bac46344f1a0fULL, 0x3366cd78201abcedULL,
+					0xa9da4a5207175299ULL, 0x030642baf1ad5022ULL, 0x5ae120669a844ab0ULL, 0xd8fc12c876b5dbb7ULL,
+					0x2f92b413a6fc6e34ULL, 0x2f2b5a6b0f30aff4ULL, 0x89633b161fac757aULL, 0x5e4bf21ca2b399c2ULL,
+					0x5ed834f955dcf6abULL, 0xd5fdc80d6fa8e6cdULL, 0xcdf09ed99544069fULL, 0xfa9adc855e53297cULL,
+					0x38fa314d5c46ab53ULL, 0x94508c05dda26a06ULL, 0x7de2dae2aa415d2cULL, 0x0000000143ed6f2eULL,
+					0x0000000000000000ULL
+				};
+				return __t;
+			}
+		};
+
+		// jump ahead for the mersenne twisters, after Haramoto et al.,
+		// "Efficient Jump Ahead for F2-Linear Random Number Generators"
+		// (2008). the characteristic polynomial p of the recurrence is
+		// recovered with Berlekamp-Massey, unless __mt_jump_tables has
+		// it. x^d mod p is then evaluated at the transition map with
+		// Horner's rule, which takes the window of the next n untempered
+		// words to the window d steps later.
+		template <class _Engine>
+		class __mt_jump
+		{
+		public:
+			typedef typename _Engine::result_type _UInt;
+			typedef std::vector<uint64_t> __poly;
+			static constexpr size_t __w = _Engine::word_size;
+			static constexpr size_t __n = _Engine::state_size;
+			static constexpr size_t __m = _Engine::shift_size;
+			static constexpr size_t __r = _Engine::mask_bits;
+			static constexpr size_t __deg = __n * __w - __r;
+			static constexpr size_t __pwords = __deg / 64 + 2;
+
+			static void advance(_Engine& __e, unsigned long long __delta)
+			{
+				if(__delta <= (1ULL << 20)){
+					__e.discard(__delta);
+					return;
+				}
+				__poly __q = __xpow(__delta);
+				__apply(__e, __xinvn(__q));
+			}
+
+			// advances by __k strides of 2^128 steps
+			static void jump(_Engine& __e, unsigned long long __k)
+			{
+				if(__k == 0){
+					return;
+				}
+				if(__k == 1){
+					__apply(__e, __stride_poly());
+					return;
+				}
+				__poly __q(__pwords, 0);
+				__q[0] = 1;
+				for(int __i = 63; __i >= 0; __i--){
+					__q = __square(__q);
+					if((__k >> __i) & 1){
+						__q = __multiply(__q, __stride_base());
+					}
+				}
+				__apply(__e, __xinvn(__q));
+			}
+
+		private:
+			// x^(2^128) mod p
+			static const __poly& __stride_base(void)
+			{
+				static const __poly __q = __mt_jump_tables<_Engine>::__stride_base()
+					? __poly(__mt_jump_tables<_Engine>::__stride_base(), __mt_jump_tables<_Engine>::__stride_base() + __pwords)
+					: __xpow2(128);
+				return __q;
+			}
+
+			// x^(2^128) x^-n mod p, computed once
+			static const __poly& __stride_poly(void)
+			{
+				static const __poly __q = __xinvn(__stride_base());
+				return __q;
+			}
+
+			static constexpr _UInt __wmask(void)
+			{
+				return __w == std::numeric_limits<_UInt>::digits ? ~_UInt(0) : ((_UInt(1) << __w) - 1);
+			}
+
+			static _UInt __untemper(_UInt __z)
+			{
+				const size_t __u = _Engine::tempering_u, __s = _Engine::tempering_s, __t = _Engine::tempering_t, __l = _Engine::tempering_l;
+				const _UInt __d = _Engine::tempering_d, __b = _Engine::tempering_b, __c = _Engine::tempering_c;
+				_UInt __x = __z;
+				for(size_t __i = 0; __i <= __w / __l; __i++){
+					__x = __z ^ (__x >> __l);
+				}
+				__z = __x;
+				for(size_t __i = 0; __i <= __w / __t; __i++){
+					__x = (__z ^ ((__x << __t) & __c)) & __wmask();
+				}
+				__z = __x;
+				for(size_t __i = 0; __i <= __w / __s; __i++){
+					__x = (__z ^ ((__x << __s) & __b)) & __wmask();
+				}
+				__z = __x;
+				for(size_t __i = 0; __i <= __w / __u; __i++){
+					__x = __z ^ ((__x >> __u) & __d);
+				}
+				return __x;
+			}
+
+			// one step of the recurrence on a window whose oldest word is __x[__p]
+			static void __step(_UInt *__x, size_t& __p)
+			{
+				const _UInt __upper = (~_UInt(0) << __r) & __wmask();
+				const _UInt __lower = (_UInt(1) << __r) - 1;
+				_UInt __y = (__x[__p] & __upper) | (__x[__p + 1 < __n ? __p + 1 : 0] & __lower);
+				size_t __pm = __p + __m < __n ? __p + __m : __p + __m - __n;
+				__x[__p] = __x[__pm] ^ (__y >> 1) ^ ((__y & 1) ? _Engine::xor_mask : _UInt(0));
+				__p = __p + 1 < __n ? __p + 1 : 0;
+			}
+
+			static bool __bit(const __poly& __a, size_t __i)
+			{
+				return (__a[__i >> 6] >> (__i & 63)) & 1;
+			}
+
+			static uint64_t __bits64(const __poly& __a, size_t __pos)
+			{
+				size_t __wi = __pos >> 6, __sh = __pos & 63;
+				uint64_t __v = __wi < __a.size() ? __a[__wi] >> __sh : 0;
+				if(__sh && __wi + 1 < __a.size()){
+					__v |= __a[__wi + 1] << (64 - __sh);
+				}
+				return __v;
+			}
+
+			// __a ^= __b << __shift
+			static void __xor_shifted(__poly& __a, const __poly& __b, size_t __shift)
+			{
+				size_t __ws = __shift >> 6, __bs = __shift & 63;
+				for(size_t __i = 0; __i < __b.size() && __i + __ws < __a.size(); __i++){
+					__a[__i + __ws] ^= __b[__i] << __bs;
+					if(__bs && __i + __ws + 1 < __a.size()){
+						__a[__i + __ws + 1] ^= __b[__i] >> (64 - __bs);
+					}
+				}
+			}
+
+			static const __poly& __charpoly(void)
+			{
+				static const __poly __p = __mt_jump_tables<_Engine>::__charpoly()
+					? __poly(__mt_jump_tables<_Engine>::__charpoly(), __mt_jump_tables<_Engine>::__charpoly() + __pwords)
+					: __compute_charpoly();
+				return __p;
+			}
+
+			static bool __parity(uint64_t __v)
+			{
+				__v ^= __v >> 32;
+				__v ^= __v >> 16;
+				__v ^= __v >> 8;
+				__v ^= __v >> 4;
+				__v ^= __v >> 2;
+				__v ^= __v >> 1;
+				return __v & 1;
+			}
+
+			static __poly __compute_charpoly(void)
+			{
+				// 2 * deg bits of the sequence of low bits, stored reversed so
+				// that the sum over the connection polynomial is a dot product
+				const size_t __len = 2 * __deg;
+				const size_t __words = __len / 64 + 2;
+				_Engine __e;
+				_UInt __x[__n];
+				for(size_t __i = 0; __i < __n; __i++){
+					__x[__i] = __untemper(__e());
+				}
+				size_t __p = 0;
+				__poly __rev(__words, 0);
+				for(size_t __k = 0; __k < __len; __k++){
+					if(__x[__p] & 1){
+						size_t __j = __len - 1 - __k;
+						__rev[__j >> 6] |= uint64_t(1) << (__j & 63);
+					}
+					__step(__x, __p);
+				}
+				__poly __c(__words, 0), __b(__words, 0), __t;
+				__c[0] = __b[0] = 1;
+				size_t __L = 0, __shift = 1;
+				for(size_t __k = 0; __k < __len; __k++){
+					size_t __o = __len - 1 - __k;
+					uint64_t __d = 0;
+					for(size_t __i = 0; __i <= __L / 64; __i++){
+						uint64_t __cw = __c[__i];
+						if(__i == __L / 64 && (__L & 63) != 63){
+							__cw &= (uint64_t(1) << ((__L & 63) + 1)) - 1;
+						}
+						__d ^= __cw & __bits64(__rev, __o + 64 * __i);
+					}
+					if(!__parity(__d)){
+						__shift++;
+					}else if(2 * __L <= __k){
+						__t = __c;
+						__xor_shifted(__c, __b, __shift);
+						__L = __k + 1 - __L;
+						__b = __t;
+						__shift = 1;
+					}else{
+						__xor_shifted(__c, __b, __shift);
+						__shift++;
+					}
+				}
+				// the characteristic polynomial is the reciprocal of the
+				// connection polynomial
+				__poly __cp(__pwords, 0);
+				for(size_t __i = 0; __i <= __L; __i++){
+					if(__bit(__c, __i)){
+						size_t __j = __L - __i;
+						__cp[__j >> 6] |= uint64_t(1) << (__j & 63);
+					}
+				}
+				return __cp;
+			}
+
+			// reduces a polynomial of degree < 2 deg modulo p
+			static __poly __reduce(__poly __a)
+			{
+				const __poly& __p = __charpoly();
+				for(size_t __i = 2 * __deg; __i-- > __deg;){
+					if(__bit(__a, __i)){
+						__xor_shifted(__a, __p, __i - __deg);
+					}
+				}
+				__a.resize(__pwords);
+				return __a;
+			}
+
+			static __poly __square(const __poly& __a)
+			{
+				__poly __s(2 * __pwords, 0);
+				for(size_t __i = 0; __i < __pwords; __i++){
+					uint64_t __v = __a[__i];
+					uint64_t __lo = 0, __hi = 0;
+					for(size_t __j = 0; __j < 32; __j++){
+						__lo |= ((__v >> __j) & 1) << (2 * __j);
+						__hi |= ((__v >> (__j + 32)) & 1) << (2 * __j);
+					}
+					__s[2 * __i] = __lo;
+					__s[2 * __i + 1] = __hi;
+				}
+				return __reduce(__s);
+			}
+
+			static __poly __multiply(const __poly& __a, const __poly& __b)
+			{
+				__poly __s(2 * __pwords, 0);
+				for(size_t __i = 0; __i < __deg; __i++){
+					if(__bit(__b, __i)){
+						__xor_shifted(__s, __a, __i);
+					}
+				}
+				return __reduce(__s);
+			}
+
+			static __poly __times_x(const __poly& __a)
+			{
+				__poly __s(2 * __pwords, 0);
+				__xor_shifted(__s, __a, 1);
+				return __reduce(__s);
+			}
+
+			static __poly __xpow(unsigned long long __d)
+			{
+				__poly __q(__pwords, 0);
+				__q[0] = 1;
+				for(int __i = 63; __i >= 0; __i--){
+					__q = __square(__q);
+					if((__d >> __i) & 1){
+						__q = __times_x(__q);
+					}
+				}
+				return __q;
+			}
+
+			static __poly __xpow2(size_t __k)
+			{
+				__poly __q(__pwords, 0);
+				__q[0] = 2;
+				for(size_t __i = 0; __i < __k; __i++){
+					__q = __square(__q);
+				}
+				return __q;
+			}
+
+			// multiplies by x^-n; p(0) = 1, so x^-1 = (p + 1) / x
+			static __poly __xinvn(__poly __q)
+			{
+				const __poly& __p = __charpoly();
+				for(size_t __i = 0; __i < __n; __i++){
+					if(__q[0] & 1){
+						for(size_t __j = 0; __j < __pwords; __j++){
+							__q[__j] ^= __p[__j];
+						}
+					}
+					for(size_t __j = 0; __j < __pwords; __j++){
+						__q[__j] = (__q[__j] >> 1) | (__j + 1 < __pwords ? __q[__j + 1] << 63 : 0);
+					}
+				}
+				return __q;
+			}
+
+			// evaluates __q at the transition map on the window of the next n
+			// words. for __q = x^(d - n), the result is the window of the n
+			// words that precede draw d, which is the state the engine
+			// reads back in
+			static void __apply(_Engine& __e, const __poly& __q)
+			{
+				_Engine __c = __e;
+				std::vector<_UInt> __x(__n), __acc(__n, 0);
+				for(size_t __i = 0; __i < __n; __i++){
+					__x[__i] = __untemper(__c());
+				}
+				size_t __pa = 0;
+				for(size_t __i = __deg; __i-- > 0;){
+					__step(__acc.data(), __pa);
+					if(__bit(__q, __i)){
+						for(size_t __j = 0, __k = __pa; __j < __n; __j++){
+							__acc[__k] ^= __x[__j];
+							__k = __k + 1 < __n ? __k + 1 : 0;
+						}
+					}
+				}
+				// write the state back in whichever layout the library uses:
+				// n words, oldest first, optionally followed by an index,
+				// which is n when the words are the previous block
+				std::stringstream __ss;
+				__ss << __e;
+				size_t __ntok = 0;
+				std::string __tok;
+				while(__ss >> __tok){
+					__ntok++;
+				}
+				__ss.str("");
+				__ss.clear();
+				for(size_t __j = 0, __k = __pa; __j < __n; __j++){
+					__ss << __acc[__k] << ' ';
+					__k = __k + 1 < __n ? __k + 1 : 0;
+				}
+				if(__ntok > __n){
+					__ss << __n;
+				}
+				__ss >> __e;
+			}
+		};
+
 		class random_device : public std::random_device
 		{
 		public:
@@ -56,6 +806,8 @@ namespace x
 			using pcg::pcg32::pcg32;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Melissa O'Neill's 32-bit Permuted Congruential Generator";
+			// advance by k strides of 2^48 draws
+			void jump(unsigned long long k = 1) {advance(state_type(k) << 48);}
 		};
 
 		class pcg64 : public pcg::pcg64
@@ -64,6 +816,8 @@ namespace x
 			using pcg::pcg64::pcg64;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Melissa O'Neill's 64-bit Permuted Congruential Generator";
+			// advance by k strides of 2^64 draws
+			void jump(unsigned long long k = 1) {advance(state_type(k) << 64);}
 		};
 
 		class minstd_rand0 : public std::minstd_rand0
@@ -72,6 +826,9 @@ namespace x
 			using std::minstd_rand0::minstd_rand0;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Discovered in 1969 by Lewis, Goodman and Miller, adopted as \"Minimal standard\" in 1988 by Park and Miller";
+			void advance(unsigned long long delta) {__lcg_advance(*this, delta);}
+			// advance by k strides of 2^24 draws, modulo the period m - 1
+			void jump(unsigned long long k = 1) {__lcg_advance(*this, (k % (modulus - 1)) << 24);}
 		};
 
 		class minstd_rand : public std::minstd_rand
@@ -80,6 +837,9 @@ namespace x
 			using std::minstd_rand::minstd_rand;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Newer \"Minimum standard\", recommended by Park, Miller, and Stockmeyer in 1993";
+			void advance(unsigned long long delta) {__lcg_advance(*this, delta);}
+			// advance by k strides of 2^24 draws, modulo the period m - 1
+			void jump(unsigned long long k = 1) {__lcg_advance(*this, (k % (modulus - 1)) << 24);}
 		};
 
 		class mt19937 : public std::mt19937
@@ -88,6 +848,9 @@ namespace x
 			using std::mt19937::mt19937;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "32-bit Mersenne Twister by Matsumoto and Nishimura, 1998";
+			void advance(unsigned long long delta) {__mt_jump<std::mt19937>::advance(*this, delta);}
+			// advance by k strides of 2^128 draws
+			void jump(unsigned long long k = 1) {__mt_jump<std::mt19937>::jump(*this, k);}
 		};
 
 		class mt19937_64 : public std::mt19937_64
@@ -96,6 +859,9 @@ namespace x
 			using std::mt19937_64::mt19937_64;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "64-bit Mersenne Twister by Matsumoto and Nishimura, 2000";
+			void advance(unsigned long long delta) {__mt_jump<std::mt19937_64>::advance(*this, delta);}
+			// advance by k strides of 2^128 draws
+			void jump(unsigned long long k = 1) {__mt_jump<std::mt19937_64>::jump(*this, k);}
 		};
 
 		class ranlux24 : public std::ranlux24
@@ -121,140 +887,1796 @@ namespace x
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Knuth's generator shuffles sequences generated with minstd_rand0";
 		};
-		
-		template <typename IntType = int>
-		//using uniform_int_distribution = std::uniform_int_distribution<IntType>;
-		class uniform_int_distribution : public std::uniform_int_distribution<IntType>
+
+		// counter based engines, after Salmon, Moraes, Dror and Shaw,
+		// "Parallel Random Numbers: As Easy as 1, 2, 3" (2011). draw i
+		// of stream s is word i % 4 of the keyed bijection _Cipher
+		// applied to the counter (s, i / 4), so any draw of any stream
+		// can be reached in constant time, and streams are independent
+		// by construction. there are 2^66 draws per stream.
+		template <class _Cipher>
+		class __counter_engine
 		{
 		public:
-			using std::uniform_int_distribution<IntType>::uniform_int_distribution;
-			//static constexpr const char * const desc_long = "";
-			static constexpr const char * const desc_short = "Produces random integers with equal probability in the range [a,b] (inclusive).";
-			static const int nparams = 2;
-			static constexpr const char * const param_a_desc = "Lower bound (inclusive)";
-			static constexpr const char * const param_b_desc = "Upper bound (inclusive)";
-			static constexpr const char * const param_desc_list[nparams] = {param_a_desc, param_b_desc};
-			struct x_param_validation validparams()
+			typedef typename _Cipher::result_type result_type;
+			static constexpr size_t key_words = _Cipher::key_words;
+			static constexpr result_type default_seed = 0;
+			static constexpr result_type min(void) {return 0;}
+			static constexpr result_type max(void) {return std::numeric_limits<result_type>::max();}
+
+		private:
+			result_type __key_[key_words];
+			uint64_t __stream_;
+			uint64_t __blk_;
+			size_t __pos_;
+			result_type __buf_[4];
+
+			void __refill(void)
 			{
-				if(this->a() < this->b()){
-					return {true, ""};
-				}else{
-					return {false, "a < b"};
+				_Cipher::block(__key_, __stream_, __blk_, __buf_);
+			}
+
+			void __step_blocks(uint64_t __n)
+			{
+				uint64_t __b = __blk_ + __n;
+				if(__b < __blk_){
+					++__stream_;
 				}
+				__blk_ = __b;
 			}
 
-			double pdf(double x) {return 1. / ((this->b() - this->a()) + 1);}
-			double cdf(double x) {return (floor(x) - this->a() + 1) / ((this->b() - this->a()) + 1);}
-			static constexpr bool meandef = 1;
-			double mean() {return (this->a() + this->b()) / 2.;}
-			static constexpr bool mediandef = 1;
-			double median() {return this->mean();}
-			static constexpr  bool modedef = false;
-			double mode() {return 0;}
-			static constexpr bool variancedef = 1;
-			double variance() {return (pow((this->b() - this->a()) + 1, 2.) - 1) / 12;}
-			static constexpr bool skewnessdef = 1;
-			double skewness() {return 0;}
-			static constexpr bool kurtosisdef = 1;
-			double kurtosis() {return -((6 * (pow((this->b() - this->a()) + 1, 2.) + 1)) / (5 * (pow((this->b() - this->a()) + 1, 2.) - 1)));}
-			
-		};
-		template <typename RealType = double>
-		//using uniform_real_distribution = std::uniform_real_distribution<RealType>;
-		class uniform_real_distribution : public std::uniform_real_distribution<RealType>
-		{
 		public:
-			using std::uniform_real_distribution<RealType>::uniform_real_distribution;
-			//static constexpr const char * const desc_long = "";
-			static constexpr const char * const desc_short = "Produces random numbers in the range [a,b) where all intervals of the same length are equally probable.";
-			static const int nparams = 2;
-			static constexpr const char * const param_a_desc = "Lower bound (inclusive)";
-			static constexpr const char * const param_b_desc = "Upper bound (inclusive)";
-			static constexpr const char * const param_desc_list[nparams] = {param_a_desc, param_b_desc};
-			struct x_param_validation validparams()
+			__counter_engine(void) {seed(default_seed);}
+			explicit __counter_engine(result_type __s) {seed(__s);}
+			template <class _Sseq, class = typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value>::type>
+			explicit __counter_engine(_Sseq& __q) {seed(__q);}
+
+			void seed(result_type __s = default_seed)
 			{
-				if(this->a() < this->b()){
-					return {true, ""};
-				}else{
-					return {false, "a < b"};
+				__key_[0] = __s;
+				for(size_t __i = 1; __i < key_words; __i++){
+					__key_[__i] = 0;
 				}
+				seek(0, 0);
 			}
 
-			double pdf(double x) {return 0;}
-			double cdf(double x) {return 0;}
-			static constexpr bool meandef = 1;
-			double mean() {return 0;}
-			static constexpr bool mediandef = 1;
-			double median() {return 0;}
-			static constexpr  bool modedef = 1;
-			double mode() {return 0;}
-			static constexpr bool variancedef = 1;
-			double variance() {return 0;}
-			static constexpr bool skewnessdef = 1;
-			double skewness() {return 0;}
-			static constexpr bool kurtosisdef = 1;
-			double kurtosis() {return 0;}
-		};
-
-		
-		template <typename IntType = int>
-		//using bernoulli_distribution = std::bernoulli_distribution;
-		class bernoulli_distribution : public std::bernoulli_distribution
-		{
-		public:
-			using std::bernoulli_distribution::bernoulli_distribution;
-			//static constexpr const char * const desc_long = "";
-			static constexpr const char * const desc_short = "Produces a 1 with probability p, and 0 with probability 1-p. Simulates a coin toss.";
-			static const int nparams = 1;
-			static constexpr const char * const param_p_desc = "Probability of success";
-			static constexpr const char * const param_desc_list[nparams] = {param_p_desc};
-			struct x_param_validation validparams()
+			template <class _Sseq>
+			typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value, void>::type
+			seed(_Sseq& __q)
 			{
-				if(this->p() >= 0 && this->p() <= 1){
-					return {true, ""};
-				}else{
-					return {false, "0 <= p <= 1"};
+				constexpr size_t __k = (sizeof(result_type) + 3) / 4;
+				uint32_t __w[key_words * __k];
+				__q.generate(__w, __w + key_words * __k);
+				for(size_t __i = 0; __i < key_words; __i++){
+					__key_[__i] = 0;
+					for(size_t __j = 0; __j < __k; __j++){
+						__key_[__i] |= result_type(__w[__i * __k + __j]) << (32 * __j);
+					}
 				}
+				seek(0, 0);
 			}
 
-			double pdf(double x) {return 0;}
-			double cdf(double x) {return 0;}
-			static constexpr bool meandef = 1;
-			double mean() {return 0;}
-			static constexpr bool mediandef = 1;
-			double median() {return 0;}
-			static constexpr  bool modedef = 1;
-			double mode() {return 0;}
-			static constexpr bool variancedef = 1;
-			double variance() {return 0;}
-			static constexpr bool skewnessdef = 1;
-			double skewness() {return 0;}
-			static constexpr bool kurtosisdef = 1;
-			double kurtosis() {return 0;}
-		};
-		template <typename IntType = int>
-		//using binomial_distribution = std::binomial_distribution<IntType>;
-		class binomial_distribution : public std::binomial_distribution<IntType>
-		{
-		public:
-			using std::binomial_distribution<IntType>::binomial_distribution;
-			//static constexpr const char * const desc_long = "";
-			static constexpr const char * const desc_short = "Produces random integers in the range [0,t], which represent the number of successes in t trials each with probability p.";
-			static const int nparams = 2;
-			static constexpr const char * const param_t_desc = "Number of trials";
-			static constexpr const char * const param_p_desc = "Probability of success";
-			static constexpr const char * const param_desc_list[nparams] = {param_t_desc, param_p_desc};
-			struct x_param_validation validparams()
+			result_type operator()(void)
 			{
-				if(this->t() < 0){
-					return {false, "t >= 0"};
-				}else if(this->p() < 0 || this->p() > 1){
-					return {false, "0 <= p <= 1"};
-				}else{
-					return {true, ""};
+				result_type __r = __buf_[__pos_];
+				if(++__pos_ == 4){
+					__pos_ = 0;
+					__step_blocks(1);
+					__refill();
 				}
+				return __r;
 			}
-			
+
+			void discard(unsigned long long __z)
+			{
+				uint64_t __p = __pos_ + __z % 4;
+				__step_blocks(__z / 4 + __p / 4);
+				__pos_ = __p % 4;
+				__refill();
+			}
+
+			void advance(unsigned long long __delta) {discard(__delta);}
+
+			// positions the engine on draw index of stream
+			void seek(uint64_t __stream, uint64_t __index)
+			{
+				__stream_ = __stream;
+				__blk_ = __index / 4;
+				__pos_ = __index % 4;
+				__refill();
+			}
+
+			uint64_t stream(void) const {return __stream_;}
+			// the low 64 bits of the index of the next draw in the stream
+			uint64_t index(void) const {return __blk_ * 4 + __pos_;}
+
+			// advance by k strides of 2^66 draws, i.e. k streams
+			void jump(unsigned long long __k = 1)
+			{
+				__stream_ += __k;
+				__refill();
+			}
+
+			friend bool operator==(const __counter_engine& __x, const __counter_engine& __y)
+			{
+				for(size_t __i = 0; __i < key_words; __i++){
+					if(__x.__key_[__i] != __y.__key_[__i]){
+						return false;
+					}
+				}
+				return __x.__stream_ == __y.__stream_ && __x.__blk_ == __y.__blk_ && __x.__pos_ == __y.__pos_;
+			}
+
+			friend bool operator!=(const __counter_engine& __x, const __counter_engine& __y)
+			{
+				return !(__x == __y);
+			}
+
+			template <class _CharT, class _Traits>
+			friend std::basic_ostream<_CharT, _Traits>& operator<<(std::basic_ostream<_CharT, _Traits>& __os, const __counter_engine& __e)
+			{
+				std::__save_flags<_CharT, _Traits> __lx(__os);
+				__os.flags(std::ios_base::dec | std::ios_base::left);
+				_CharT __sp = __os.widen(' ');
+				__os.fill(__sp);
+				for(size_t __i = 0; __i < key_words; __i++){
+					__os << __e.__key_[__i] << __sp;
+				}
+				__os << __e.__stream_ << __sp << __e.__blk_ << __sp << __e.__pos_;
+				return __os;
+			}
+
+			template <class _CharT, class _Traits>
+			friend std::basic_istream<_CharT, _Traits>& operator>>(std::basic_istream<_CharT, _Traits>& __is, __counter_engine& __e)
+			{
+				std::__save_flags<_CharT, _Traits> __lx(__is);
+				__is.flags(std::ios_base::dec | std::ios_base::skipws);
+				result_type __key[key_words];
+				uint64_t __stream, __blk;
+				size_t __pos;
+				for(size_t __i = 0; __i < key_words; __i++){
+					__is >> __key[__i];
+				}
+				__is >> __stream >> __blk >> __pos;
+				if(!__is.fail()){
+					for(size_t __i = 0; __i < key_words; __i++){
+						__e.__key_[__i] = __key[__i];
+					}
+					__e.__stream_ = __stream;
+					__e.__blk_ = __blk;
+					__e.__pos_ = __pos % 4;
+					__e.__refill();
+				}
+				return __is;
+			}
+		};
+
+		// Philox4x32-10: 10 rounds of two 32x32 bit multiplications
+		struct __philox4x32_10
+		{
+			typedef uint32_t result_type;
+			static constexpr size_t key_words = 2;
+			static void block(const result_type *__key, uint64_t __stream, uint64_t __blk, result_type *__out)
+			{
+				uint32_t __c0 = (uint32_t)__blk, __c1 = (uint32_t)(__blk >> 32);
+				uint32_t __c2 = (uint32_t)__stream, __c3 = (uint32_t)(__stream >> 32);
+				uint32_t __k0 = __key[0], __k1 = __key[1];
+				for(int __r = 0; __r < 10; __r++){
+					if(__r){
+						__k0 += 0x9E3779B9;
+						__k1 += 0xBB67AE85;
+					}
+					uint64_t __p0 = (uint64_t)0xD2511F53 * __c0;
+					uint64_t __p1 = (uint64_t)0xCD9E8D57 * __c2;
+					__c0 = (uint32_t)(__p1 >> 32) ^ __c1 ^ __k0;
+					__c1 = (uint32_t)__p1;
+					__c2 = (uint32_t)(__p0 >> 32) ^ __c3 ^ __k1;
+					__c3 = (uint32_t)__p0;
+				}
+				__out[0] = __c0;
+				__out[1] = __c1;
+				__out[2] = __c2;
+				__out[3] = __c3;
+			}
+		};
+
+		// Threefry4x64-20: 20 rounds of the Threefish-256 add, rotate, xor
+		// mix with a key injection every fourth round
+		struct __threefry4x64_20
+		{
+			typedef uint64_t result_type;
+			static constexpr size_t key_words = 4;
+			static uint64_t __rotl(uint64_t __x, int __n) {return (__x << __n) | (__x >> (64 - __n));}
+			static void block(const result_type *__key, uint64_t __stream, uint64_t __blk, result_type *__out)
+			{
+				static const int __rot[8][2] = {{14, 16}, {52, 57}, {23, 40}, {5, 37}, {25, 33}, {46, 12}, {58, 22}, {32, 32}};
+				uint64_t __ks[5];
+				__ks[4] = 0x1BD11BDAA9FC1A22ULL;
+				for(int __i = 0; __i < 4; __i++){
+					__ks[__i] = __key[__i];
+					__ks[4] ^= __key[__i];
+				}
+				uint64_t __x[4] = {__blk + __ks[0], __stream + __ks[1], __ks[2], __ks[3]};
+				for(int __r = 0; __r < 20; __r++){
+					const int *__R = __rot[__r % 8];
+					if(__r % 2 == 0){
+						__x[0] += __x[1]; __x[1] = __rotl(__x[1], __R[0]); __x[1] ^= __x[0];
+						__x[2] += __x[3]; __x[3] = __rotl(__x[3], __R[1]); __x[3] ^= __x[2];
+					}else{
+						__x[0] += __x[3]; __x[3] = __rotl(__x[3], __R[0]); __x[3] ^= __x[0];
+						__x[2] += __x[1]; __x[1] = __rotl(__x[1], __R[1]); __x[1] ^= __x[2];
+					}
+					if(__r % 4 == 3){
+						uint64_t __s = (__r + 1) / 4;
+						for(int __i = 0; __i < 4; __i++){
+							__x[__i] += __ks[(__s + __i) % 5];
+						}
+						__x[3] += __s;
+					}
+				}
+				for(int __i = 0; __i < 4; __i++){
+					__out[__i] = __x[__i];
+				}
+			}
+		};
+
+		// xoshiro256++ (Blackman and Vigna, "Scrambled Linear
+		// Pseudorandom Number Generators", 2019) run on _Lanes states in
+		// lockstep, lane i starting i jumps of 2^128 steps past lane 0.
+		// the states are kept one array per state word, so that a step
+		// of all lanes is a handful of vector instructions, and words
+		// come out one step of all lanes at a time, a block of _Steps
+		// steps per refill.
+		template <size_t _Lanes, size_t _Steps>
+		class __xoshiro256pp_lanes
+		{
+		public:
+			typedef uint64_t result_type;
+			static constexpr size_t lanes = _Lanes;
+			static constexpr size_t block_size = _Lanes * _Steps;
+			static constexpr result_type default_seed = 0;
+			static constexpr result_type min(void) {return 0;}
+			static constexpr result_type max(void) {return ~result_type(0);}
+
+		private:
+			uint64_t __s_[4][_Lanes];
+			uint64_t __buf_[block_size];
+			size_t __pos_;
+
+			static uint64_t __rotl(uint64_t __x, int __k) {return (__x << __k) | (__x >> (64 - __k));}
+
+			// writes __steps steps of all lanes to __out, or just advances
+			// the lanes if __out is NULL
+			void __block(uint64_t *__out, size_t __steps)
+			{
+#if defined(X_RANDOM_AVX2)
+				constexpr size_t __g = _Lanes / 4;
+				__m256i __s0[__g], __s1[__g], __s2[__g], __s3[__g];
+				for(size_t __j = 0; __j < __g; __j++){
+					__s0[__j] = _mm256_loadu_si256((const __m256i *)(__s_[0] + 4 * __j));
+					__s1[__j] = _mm256_loadu_si256((const __m256i *)(__s_[1] + 4 * __j));
+					__s2[__j] = _mm256_loadu_si256((const __m256i *)(__s_[2] + 4 * __j));
+					__s3[__j] = _mm256_loadu_si256((const __m256i *)(__s_[3] + 4 * __j));
+				}
+				for(size_t __i = 0; __i < __steps; __i++){
+					for(size_t __j = 0; __j < __g; __j++){
+						if(__out){
+							__m256i __x = _mm256_add_epi64(__s0[__j], __s3[__j]);
+							__x = _mm256_or_si256(_mm256_slli_epi64(__x, 23), _mm256_srli_epi64(__x, 41));
+							_mm256_storeu_si256((__m256i *)(__out + __i * _Lanes + 4 * __j), _mm256_add_epi64(__x, __s0[__j]));
+						}
+						__m256i __t = _mm256_slli_epi64(__s1[__j], 17);
+						__s2[__j] = _mm256_xor_si256(__s2[__j], __s0[__j]);
+						__s3[__j] = _mm256_xor_si256(__s3[__j], __s1[__j]);
+						__s1[__j] = _mm256_xor_si256(__s1[__j], __s2[__j]);
+						__s0[__j] = _mm256_xor_si256(__s0[__j], __s3[__j]);
+						__s2[__j] = _mm256_xor_si256(__s2[__j], __t);
+						__s3[__j] = _mm256_or_si256(_mm256_slli_epi64(__s3[__j], 45), _mm256_srli_epi64(__s3[__j], 19));
+					}
+				}
+				for(size_t __j = 0; __j < __g; __j++){
+					_mm256_storeu_si256((__m256i *)(__s_[0] + 4 * __j), __s0[__j]);
+					_mm256_storeu_si256((__m256i *)(__s_[1] + 4 * __j), __s1[__j]);
+					_mm256_storeu_si256((__m256i *)(__s_[2] + 4 * __j), __s2[__j]);
+					_mm256_storeu_si256((__m256i *)(__s_[3] + 4 * __j), __s3[__j]);
+				}
+#elif defined(X_RANDOM_SSE2)
+				constexpr size_t __g = _Lanes / 2;
+				__m128i __s0[__g], __s1[__g], __s2[__g], __s3[__g];
+				for(size_t __j = 0; __j < __g; __j++){
+					__s0[__j] = _mm_loadu_si128((const __m128i *)(__s_[0] + 2 * __j));
+					__s1[__j] = _mm_loadu_si128((const __m128i *)(__s_[1] + 2 * __j));
+					__s2[__j] = _mm_loadu_si128((const __m128i *)(__s_[2] + 2 * __j));
+					__s3[__j] = _mm_loadu_si128((const __m128i *)(__s_[3] + 2 * __j));
+				}
+				for(size_t __i = 0; __i < __steps; __i++){
+					for(size_t __j = 0; __j < __g; __j++){
+						if(__out){
+							__m128i __x = _mm_add_epi64(__s0[__j], __s3[__j]);
+							__x = _mm_or_si128(_mm_slli_epi64(__x, 23), _mm_srli_epi64(__x, 41));
+							_mm_storeu_si128((__m128i *)(__out + __i * _Lanes + 2 * __j), _mm_add_epi64(__x, __s0[__j]));
+						}
+						__m128i __t = _mm_slli_epi64(__s1[__j], 17);
+						__s2[__j] = _mm_xor_si128(__s2[__j], __s0[__j]);
+						__s3[__j] = _mm_xor_si128(__s3[__j], __s1[__j]);
+						__s1[__j] = _mm_xor_si128(__s1[__j], __s2[__j]);
+						__s0[__j] = _mm_xor_si128(__s0[__j], __s3[__j]);
+						__s2[__j] = _mm_xor_si128(__s2[__j], __t);
+						__s3[__j] = _mm_or_si128(_mm_slli_epi64(__s3[__j], 45), _mm_srli_epi64(__s3[__j], 19));
+					}
+				}
+				for(size_t __j = 0; __j < __g; __j++){
+					_mm_storeu_si128((__m128i *)(__s_[0] + 2 * __j), __s0[__j]);
+					_mm_storeu_si128((__m128i *)(__s_[1] + 2 * __j), __s1[__j]);
+					_mm_storeu_si128((__m128i *)(__s_[2] + 2 * __j), __s2[__j]);
+					_mm_storeu_si128((__m128i *)(__s_[3] + 2 * __j), __s3[__j]);
+				}
+#elif defined(X_RANDOM_NEON)
+				constexpr size_t __g = _Lanes / 2;
+				uint64x2_t __s0[__g], __s1[__g], __s2[__g], __s3[__g];
+				for(size_t __j = 0; __j < __g; __j++){
+					__s0[__j] = vld1q_u64(__s_[0] + 2 * __j);
+					__s1[__j] = vld1q_u64(__s_[1] + 2 * __j);
+					__s2[__j] = vld1q_u64(__s_[2] + 2 * __j);
+					__s3[__j] = vld1q_u64(__s_[3] + 2 * __j);
+				}
+				for(size_t __i = 0; __i < __steps; __i++){
+					for(size_t __j = 0; __j < __g; __j++){
+						if(__out){
+							uint64x2_t __x = vaddq_u64(__s0[__j], __s3[__j]);
+							__x = vorrq_u64(vshlq_n_u64(__x, 23), vshrq_n_u64(__x, 41));
+							vst1q_u64(__out + __i * _Lanes + 2 * __j, vaddq_u64(__x, __s0[__j]));
+						}
+						uint64x2_t __t = vshlq_n_u64(__s1[__j], 17);
+						__s2[__j] = veorq_u64(__s2[__j], __s0[__j]);
+						__s3[__j] = veorq_u64(__s3[__j], __s1[__j]);
+						__s1[__j] = veorq_u64(__s1[__j], __s2[__j]);
+						__s0[__j] = veorq_u64(__s0[__j], __s3[__j]);
+						__s2[__j] = veorq_u64(__s2[__j], __t);
+						__s3[__j] = vorrq_u64(vshlq_n_u64(__s3[__j], 45), vshrq_n_u64(__s3[__j], 19));
+					}
+				}
+				for(size_t __j = 0; __j < __g; __j++){
+					vst1q_u64(__s_[0] + 2 * __j, __s0[__j]);
+					vst1q_u64(__s_[1] + 2 * __j, __s1[__j]);
+					vst1q_u64(__s_[2] + 2 * __j, __s2[__j]);
+					vst1q_u64(__s_[3] + 2 * __j, __s3[__j]);
+				}
+#else
+				for(size_t __i = 0; __i < __steps; __i++){
+					for(size_t __j = 0; __j < _Lanes; __j++){
+						if(__out){
+							__out[__i * _Lanes + __j] = __rotl(__s_[0][__j] + __s_[3][__j], 23) + __s_[0][__j];
+						}
+						uint64_t __t = __s_[1][__j] << 17;
+						__s_[2][__j] ^= __s_[0][__j];
+						__s_[3][__j] ^= __s_[1][__j];
+						__s_[1][__j] ^= __s_[2][__j];
+						__s_[0][__j] ^= __s_[3][__j];
+						__s_[2][__j] ^= __t;
+						__s_[3][__j] = __rotl(__s_[3][__j], 45);
+					}
+				}
+#endif
+			}
+
+			void __refill(void)
+			{
+				__block(__buf_, _Steps);
+				__pos_ = 0;
+			}
+
+			// applies the jump polynomial __poly to lane __j
+			void __jump_lane(size_t __j, const uint64_t (&__poly)[4])
+			{
+				uint64_t __s[4] = {__s_[0][__j], __s_[1][__j], __s_[2][__j], __s_[3][__j]};
+				uint64_t __r[4] = {0, 0, 0, 0};
+				for(int __w = 0; __w < 4; __w++){
+					for(int __b = 0; __b < 64; __b++){
+						if(__poly[__w] & (uint64_t(1) << __b)){
+							for(int __k = 0; __k < 4; __k++){
+								__r[__k] ^= __s[__k];
+							}
+						}
+						uint64_t __t = __s[1] << 17;
+						__s[2] ^= __s[0];
+						__s[3] ^= __s[1];
+						__s[1] ^= __s[2];
+						__s[0] ^= __s[3];
+						__s[2] ^= __t;
+						__s[3] = __rotl(__s[3], 45);
+					}
+				}
+				for(int __k = 0; __k < 4; __k++){
+					__s_[__k][__j] = __r[__k];
+				}
+			}
+
+			// 2^128 steps
+			static constexpr uint64_t __jump_poly[4] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+			// 2^192 steps
+			static constexpr uint64_t __long_jump_poly[4] = {0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL};
+
+			// spreads lane 0 over the other lanes
+			void __init_lanes(void)
+			{
+				if(!(__s_[0][0] | __s_[1][0] | __s_[2][0] | __s_[3][0])){
+					__s_[0][0] = 1;
+				}
+				for(size_t __j = 1; __j < _Lanes; __j++){
+					for(int __k = 0; __k < 4; __k++){
+						__s_[__k][__j] = __s_[__k][__j - 1];
+					}
+					__jump_lane(__j, __jump_poly);
+				}
+				__refill();
+			}
+
+		public:
+			__xoshiro256pp_lanes(void) {seed(default_seed);}
+			explicit __xoshiro256pp_lanes(result_type __s) {seed(__s);}
+			template <class _Sseq, class = typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value>::type>
+			explicit __xoshiro256pp_lanes(_Sseq& __q) {seed(__q);}
+
+			// lane 0 is filled from splitmix64, as recommended by the authors
+			void seed(result_type __s = default_seed)
+			{
+				for(int __k = 0; __k < 4; __k++){
+					uint64_t __z = (__s += 0x9e3779b97f4a7c15ULL);
+					__z = (__z ^ (__z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+					__z = (__z ^ (__z >> 27)) * 0x94d049bb133111ebULL;
+					__s_[__k][0] = __z ^ (__z >> 31);
+				}
+				__init_lanes();
+			}
+
+			template <class _Sseq>
+			typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value, void>::type
+			seed(_Sseq& __q)
+			{
+				uint32_t __w[8];
+				__q.generate(__w, __w + 8);
+				for(int __k = 0; __k < 4; __k++){
+					__s_[__k][0] = uint64_t(__w[2 * __k]) | (uint64_t(__w[2 * __k + 1]) << 32);
+				}
+				__init_lanes();
+			}
+
+			// the lanes are _Steps steps past the start of the buffered
+			// block. once it is used up (__pos_ == block_size) they are
+			// at the start of the next one, which is computed lazily.
+			result_type operator()(void)
+			{
+				if(__pos_ == block_size){
+					__refill();
+				}
+				return __buf_[__pos_++];
+			}
+
+			// writes the next __last - __first draws, the same ones that
+			// as many calls to operator() would return. whole steps go
+			// straight from the lanes to the output.
+			void generate(result_type *__first, result_type *__last)
+			{
+				while(__first < __last && __pos_ < block_size){
+					*__first++ = __buf_[__pos_++];
+				}
+				size_t __steps = (__last - __first) / _Lanes;
+				if(__steps){
+					__block(__first, __steps);
+					__first += __steps * _Lanes;
+				}
+				while(__first < __last){
+					*__first++ = operator()();
+				}
+			}
+
+			void discard(unsigned long long __z)
+			{
+				while(__z && __pos_ < block_size){
+					__pos_++;
+					__z--;
+				}
+				if(__z){
+					__block(NULL, __z / _Lanes);
+					__refill();
+					__pos_ = __z % _Lanes;
+				}
+			}
+
+			void advance(unsigned long long __delta) {discard(__delta);}
+
+			// advance every lane by k strides of 2^192 steps
+			void jump(unsigned long long __k = 1)
+			{
+				if(!__k){
+					return;
+				}
+				// the buffered words are the next ones of the old lanes,
+				// so rewind the lanes to the start of the block first
+				size_t __pos = __pos_;
+				if(__pos < block_size){
+					__rewind();
+				}
+				for(unsigned long long __i = 0; __i < __k; __i++){
+					for(size_t __j = 0; __j < _Lanes; __j++){
+						__jump_lane(__j, __long_jump_poly);
+					}
+				}
+				if(__pos < block_size){
+					__refill();
+					__pos_ = __pos;
+				}
+			}
+
+			// engines are compared by the step the next draw comes from,
+			// since equal engines may have split their output into blocks
+			// differently
+			friend bool operator==(const __xoshiro256pp_lanes& __x, const __xoshiro256pp_lanes& __y)
+			{
+				__xoshiro256pp_lanes __cx = __x, __cy = __y;
+				return __cx.__canonicalize() == __cy.__canonicalize() && __cx.__equal_lanes(__cy);
+			}
+
+			friend bool operator!=(const __xoshiro256pp_lanes& __x, const __xoshiro256pp_lanes& __y)
+			{
+				return !(__x == __y);
+			}
+
+			// the lanes are written as they are at the step the next draw
+			// comes from, followed by the lane it comes from
+			template <class _CharT, class _Traits>
+			friend std::basic_ostream<_CharT, _Traits>& operator<<(std::basic_ostream<_CharT, _Traits>& __os, const __xoshiro256pp_lanes& __e)
+			{
+				std::__save_flags<_CharT, _Traits> __lx(__os);
+				__os.flags(std::ios_base::dec | std::ios_base::left);
+				_CharT __sp = __os.widen(' ');
+				__os.fill(__sp);
+				__xoshiro256pp_lanes __c = __e;
+				size_t __lane = __c.__canonicalize();
+				for(size_t __j = 0; __j < _Lanes; __j++){
+					for(int __k = 0; __k < 4; __k++){
+						__os << __c.__s_[__k][__j] << __sp;
+					}
+				}
+				__os << __lane;
+				return __os;
+			}
+
+			template <class _CharT, class _Traits>
+			friend std::basic_istream<_CharT, _Traits>& operator>>(std::basic_istream<_CharT, _Traits>& __is, __xoshiro256pp_lanes& __e)
+			{
+				std::__save_flags<_CharT, _Traits> __lx(__is);
+				__is.flags(std::ios_base::dec | std::ios_base::skipws);
+				uint64_t __s[4][_Lanes];
+				size_t __pos;
+				for(size_t __j = 0; __j < _Lanes; __j++){
+					for(int __k = 0; __k < 4; __k++){
+						__is >> __s[__k][__j];
+					}
+				}
+				__is >> __pos;
+				if(!__is.fail()){
+					for(size_t __j = 0; __j < _Lanes; __j++){
+						for(int __k = 0; __k < 4; __k++){
+							__e.__s_[__k][__j] = __s[__k][__j];
+						}
+					}
+					__e.__refill();
+					__e.__pos_ = __pos % _Lanes;
+				}
+				return __is;
+			}
+
+		private:
+			// moves the lanes to the step the next draw comes from, leaving
+			// the buffer stale, and returns the lane the draw comes from
+			size_t __canonicalize(void)
+			{
+				if(__pos_ == block_size){
+					return 0;
+				}
+				__rewind();
+				__block(NULL, __pos_ / _Lanes);
+				return __pos_ % _Lanes;
+			}
+
+			bool __equal_lanes(const __xoshiro256pp_lanes& __y) const
+			{
+				for(size_t __j = 0; __j < _Lanes; __j++){
+					for(int __k = 0; __k < 4; __k++){
+						if(__s_[__k][__j] != __y.__s_[__k][__j]){
+							return false;
+						}
+					}
+				}
+				return true;
+			}
+
+			// steps every lane back to the start of the buffered block
+			void __rewind(void)
+			{
+				for(size_t __j = 0; __j < _Lanes; __j++){
+					uint64_t __s0 = __s_[0][__j], __s1 = __s_[1][__j], __s2 = __s_[2][__j], __s3 = __s_[3][__j];
+					for(size_t __i = 0; __i < _Steps; __i++){
+						// one step maps (a, b, c, d) to (a ^ b ^ d,
+						// a ^ b ^ c, a ^ c ^ (b << 17), rotl(b ^ d, 45))
+						uint64_t __bd = __rotl(__s3, 19);
+						uint64_t __a = __s0 ^ __bd;
+						uint64_t __u = __s1 ^ __s2;
+						uint64_t __b = __u ^ (__u << 17) ^ (__u << 34) ^ (__u << 51);
+						__s2 = __s1 ^ __a ^ __b;
+						__s3 = __bd ^ __b;
+						__s0 = __a;
+						__s1 = __b;
+					}
+					__s_[0][__j] = __s0;
+					__s_[1][__j] = __s1;
+					__s_[2][__j] = __s2;
+					__s_[3][__j] = __s3;
+				}
+			}
+		};
+
+		class xoshiro256pp : public __xoshiro256pp_lanes<8, 8>
+		{
+		public:
+			using __xoshiro256pp_lanes<8, 8>::__xoshiro256pp_lanes;
+			//static constexpr const char * const desc_long = "";
+			static constexpr const char * const desc_short = "Eight lanes of Blackman and Vigna's xoshiro256++, 2019, stepped together with SIMD instructions";
+		};
+
+		class philox4x32 : public __counter_engine<__philox4x32_10>
+		{
+		public:
+			using __counter_engine<__philox4x32_10>::__counter_engine;
+			//static constexpr const char * const desc_long = "";
+			static constexpr const char * const desc_short = "Counter based Philox4x32-10 generator by Salmon, Moraes, Dror and Shaw, 2011";
+		};
+
+		class threefry4x64 : public __counter_engine<__threefry4x64_20>
+		{
+		public:
+			using __counter_engine<__threefry4x64_20>::__counter_engine;
+			//static constexpr const char * const desc_long = "";
+			static constexpr const char * const desc_short = "Counter based Threefry4x64-20 generator by Salmon, Moraes, Dror and Shaw, 2011";
+		};
+		
+		constexpr int __bit_width64(uint64_t __x)
+		{
+			int __n = 0;
+			for(; __x; __x >>= 1){
+				__n++;
+			}
+			return __n;
+		}
+
+		// the width of an engine's words. a power of two range gives
+		// all its bits. a range of c values that is not one gives the
+		// low w bits of the words below the largest multiple of 2^w in
+		// the range, and the rest are rejected. w is picked for the
+		// most bits a word on average: minstd and knuth_b give 27 bits
+		// from 15/16 of their words.
+		template <class _URNG>
+		constexpr int __engine_bits()
+		{
+			constexpr uint64_t __r = uint64_t(_URNG::max()) - uint64_t(_URNG::min());
+			if constexpr((__r & (__r + 1)) == 0){
+				return __bit_width64(__r);
+			}else{
+				const uint64_t __c = __r + 1;
+				int __best = 1;
+				double __most = 0;
+				for(int __w = 1; __w < 64 && (uint64_t(1) << __w) <= __c; __w++){
+					double __bits = __w * (double((__c >> __w) << __w) / double(__c));
+					if(__bits > __most){
+						__most = __bits;
+						__best = __w;
+					}
+				}
+				return __best;
+			}
+		}
+
+		// one word of __engine_bits uniformly distributed bits
+		template <class _URNG>
+		inline uint64_t __engine_word(_URNG& __g)
+		{
+			constexpr uint64_t __r = uint64_t(_URNG::max()) - uint64_t(_URNG::min());
+			if constexpr((__r & (__r + 1)) == 0){
+				return uint64_t(__g() - _URNG::min());
+			}else{
+				constexpr int __w = __engine_bits<_URNG>();
+				constexpr uint64_t __lim = ((__r + 1) >> __w) << __w;
+				uint64_t __x;
+				do{
+					__x = uint64_t(__g() - _URNG::min());
+				}while(__x >= __lim);
+				return __x & ((uint64_t(1) << __w) - 1);
+			}
+		}
+
+		// _Bits uniformly distributed bits, at most 64, from as few
+		// engine words as hold them, taking the top bits of each. the
+		// same words give the same bits on every standard library.
+		template <int _Bits, class _URNG>
+		inline uint64_t __random_bits(_URNG& __g)
+		{
+			constexpr int __w = __engine_bits<_URNG>();
+			if constexpr(__w >= _Bits){
+				return __engine_word(__g) >> (__w - _Bits);
+			}else{
+				uint64_t __x = 0;
+				for(int __n = 0; __n < _Bits; __n += __w){
+					// only as many bits of the last word as fit
+					const int __k = _Bits - __n < __w ? _Bits - __n : __w;
+					__x = (__x << __k) | (__engine_word(__g) >> (__w - __k));
+				}
+				return __x;
+			}
+		}
+
+		// 64 uniformly distributed bits from any URNG
+		template <class _URNG>
+		inline uint64_t __random_bits64(_URNG& __g)
+		{
+			return __random_bits<64>(__g);
+		}
+
+		// uniform on the open interval (0, 1) from the top 53 bits of a word
+		inline double __open_unit(uint64_t __b)
+		{
+			return ((__b >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+		}
+
+		// the resolution of the unit uniforms the samplers draw: at
+		// least X_RANDOM_UNIFORM_BITS bits, and as many of a double's 53
+		// as the engine words that takes will hold. the default of 53
+		// takes one word from 64 bit engines and two from 32 bit
+		// engines. asking for 32 takes one word from either, at the cost
+		// of inverted tails that stop at about 2^-33; define
+		// X_RANDOM_UNIFORM_BITS to change the default, or draw through a
+		// uniform_bits_engine to change it for one call.
+#ifndef X_RANDOM_UNIFORM_BITS
+#define X_RANDOM_UNIFORM_BITS 53
+#endif
+
+		// a reference to an engine that has the samplers draw their
+		// unit uniforms at _Bits bits rather than X_RANDOM_UNIFORM_BITS:
+		//	uniform_bits_engine<32, pcg32> g32(g);
+		//	double x = d(g32);
+		template <int _Bits, class _URNG>
+		class uniform_bits_engine
+		{
+			_URNG& __g_;
+		public:
+			static_assert(_Bits > 0 && _Bits <= 53, "uniform_bits_engine: 0 < _Bits <= 53");
+			typedef typename _URNG::result_type result_type;
+			explicit uniform_bits_engine(_URNG& __g) : __g_(__g) {}
+			static constexpr result_type min() {return _URNG::min();}
+			static constexpr result_type max() {return _URNG::max();}
+			result_type operator()(void) {return __g_();}
+			void discard(unsigned long long __z) {__g_.discard(__z);}
+		};
+
+		template <int _Bits, class _URNG>
+		inline uniform_bits_engine<_Bits, _URNG> uniform_bits(_URNG& __g)
+		{
+			return uniform_bits_engine<_Bits, _URNG>(__g);
+		}
+
+		template <class _URNG>
+		struct __requested_uniform_bits
+		{
+			static constexpr int value = X_RANDOM_UNIFORM_BITS;
+		};
+
+		template <int _Bits, class _URNG>
+		struct __requested_uniform_bits<uniform_bits_engine<_Bits, _URNG>>
+		{
+			static constexpr int value = _Bits;
+		};
+
+		template <class _URNG>
+		constexpr int __uniform_bits()
+		{
+			constexpr int __w = __engine_bits<_URNG>();
+			constexpr int __k = (__requested_uniform_bits<_URNG>::value + __w - 1) / __w;
+			return __k * __w < 53 ? __k * __w : 53;
+		}
+
+		// uniform on the open interval (0, 1), on a grid of 2^-bits with
+		// bits = __uniform_bits unless given
+		template <int _Bits = 0, class _URNG>
+		inline double __open_uniform(_URNG& __g)
+		{
+			constexpr int __b = _Bits ? _Bits : __uniform_bits<_URNG>();
+			return (__random_bits<__b>(__g) + 0.5) * (1.0 / double(uint64_t(1) << __b));
+		}
+
+		// uniform on [0, 1): floats take 24 bits from one word, doubles
+		// __uniform_bits
+		template <class _RealType, class _URNG>
+		inline _RealType __canonical(_URNG& __g)
+		{
+			if constexpr(std::is_same<_RealType, float>::value){
+				return __random_bits<24>(__g) * (1.0f / 16777216.0f);
+			}else{
+				constexpr int __b = __uniform_bits<_URNG>();
+				return _RealType(__random_bits<__b>(__g) * (1.0 / double(uint64_t(1) << __b)));
+			}
+		}
+
+		// exp, log and sqrt that can run at compile time, good to an ulp
+		// or two over the ranges the ziggurat tables need
+		constexpr double __constexpr_exp(double __x)
+		{
+			const double __ln2 = 0.693147180559945309417;
+			long __k = (long)(__x / __ln2 + (__x < 0 ? -0.5 : 0.5));
+			double __r = __x - __k * __ln2;
+			double __t = 1, __s = 1;
+			for(int __i = 1; __i < 24; __i++){
+				__t *= __r / __i;
+				__s += __t;
+			}
+			for(; __k > 0; __k--){
+				__s *= 2;
+			}
+			for(; __k < 0; __k++){
+				__s /= 2;
+			}
+			return __s;
+		}
+
+		constexpr double __constexpr_log(double __x)
+		{
+			const double __ln2 = 0.693147180559945309417;
+			long __k = 0;
+			while(__x > 1.41421356237309504880){
+				__x /= 2;
+				__k++;
+			}
+			while(__x < 0.70710678118654752440){
+				__x *= 2;
+				__k--;
+			}
+			// log x = 2 atanh((x - 1) / (x + 1))
+			double __z = (__x - 1) / (__x + 1), __z2 = __z * __z, __t = __z, __s = 0;
+			for(int __i = 1; __i < 64; __i += 2){
+				__s += __t / __i;
+				__t *= __z2;
+			}
+			return 2 * __s + __k * __ln2;
+		}
+
+		constexpr double __constexpr_sqrt(double __x)
+		{
+			if(__x <= 0){
+				return 0;
+			}
+			// newton from above decreases monotonically until it stalls
+			double __y = __x > 1 ? __x : 1;
+			while(true){
+				double __n = (__y + __x / __y) / 2;
+				if(__n >= __y){
+					return __y;
+				}
+				__y = __n;
+			}
+		}
+
+		// ziggurat of _N layers of equal area v under a decreasing
+		// density f, after Marsaglia and Tsang, 2000. x[0] = v / f(r) is
+		// the width of the base strip (rectangle plus tail), x[1] = r,
+		// and each layer above sits on the one below, up to x[_N] = 0.
+		// f[i] = f(x[i]).
+		template <size_t _N>
+		struct __ziggurat_table
+		{
+			static constexpr size_t layers = _N;
+			double x[_N + 1];
+			double f[_N + 1];
+		};
+
+		// f(x) = exp(-x^2 / 2)
+		constexpr __ziggurat_table<128> __make_ziggurat_normal_table(double __r, double __v)
+		{
+			__ziggurat_table<128> __t{};
+			__t.f[1] = __constexpr_exp(-__r * __r / 2);
+			__t.x[0] = __v / __t.f[1];
+			__t.f[0] = __constexpr_exp(-__t.x[0] * __t.x[0] / 2);
+			__t.x[1] = __r;
+			for(size_t __i = 2; __i < 128; __i++){
+				__t.x[__i] = __constexpr_sqrt(-2 * __constexpr_log(__v / __t.x[__i - 1] + __t.f[__i - 1]));
+				__t.f[__i] = __constexpr_exp(-__t.x[__i] * __t.x[__i] / 2);
+			}
+			__t.x[128] = 0;
+			__t.f[128] = 1;
+			return __t;
+		}
+
+		// f(x) = exp(-x)
+		constexpr __ziggurat_table<256> __make_ziggurat_exponential_table(double __r, double __v)
+		{
+			__ziggurat_table<256> __t{};
+			__t.f[1] = __constexpr_exp(-__r);
+			__t.x[0] = __v / __t.f[1];
+			__t.f[0] = __constexpr_exp(-__t.x[0]);
+			__t.x[1] = __r;
+			for(size_t __i = 2; __i < 256; __i++){
+				__t.x[__i] = -__constexpr_log(__v / __t.x[__i - 1] + __t.f[__i - 1]);
+				__t.f[__i] = __constexpr_exp(-__t.x[__i]);
+			}
+			__t.x[256] = 0;
+			__t.f[256] = 1;
+			return __t;
+		}
+
+		struct __ziggurat_normal
+		{
+			static constexpr double r = 3.442619855899;
+			static constexpr double v = 9.91256303526217e-3;
+			static constexpr __ziggurat_table<128> table = __make_ziggurat_normal_table(r, v);
+
+			// the low 7 bits of one word pick the layer and the top 53
+			// give a signed fraction of its width, so nearly every draw
+			// is a multiply and a compare
+			template <class _URNG>
+			static double sample(_URNG& __g)
+			{
+				while(true){
+					uint64_t __b = __random_bits64(__g);
+					size_t __i = __b & 0x7f;
+					double __u = 2 * ((__b >> 11) * (1.0 / 9007199254740992.0)) - 1;
+					double __x = __u * table.x[__i];
+					if(fabs(__x) < table.x[__i + 1]){
+						return __x;
+					}
+					if(__i == 0){
+						// past r: Marsaglia's tail method, 1964
+						double __xt, __yt;
+						do{
+							__xt = -log(__open_unit(__random_bits64(__g))) / r;
+							__yt = -log(__open_unit(__random_bits64(__g)));
+						}while(__yt + __yt < __xt * __xt);
+						return __u < 0 ? -(r + __xt) : r + __xt;
+					}
+					double __y = table.f[__i] + (table.f[__i + 1] - table.f[__i]) * __open_unit(__random_bits64(__g));
+					if(__y < exp(-__x * __x / 2)){
+						return __x;
+					}
+				}
+			}
+		};
+
+		struct __ziggurat_exponential
+		{
+			static constexpr double r = 7.69711747013104972;
+			static constexpr double v = 3.949659822581572e-3;
+			static constexpr __ziggurat_table<256> table = __make_ziggurat_exponential_table(r, v);
+
+			// the tail past r is r plus another exponential, so falling
+			// off the base strip just shifts and goes round again
+			template <class _URNG>
+			static double sample(_URNG& __g)
+			{
+				double __shift = 0;
+				while(true){
+					uint64_t __b = __random_bits64(__g);
+					size_t __i = __b & 0xff;
+					double __x = ((__b >> 11) * (1.0 / 9007199254740992.0)) * table.x[__i];
+					if(__x < table.x[__i + 1]){
+						return __shift + __x;
+					}
+					if(__i == 0){
+						__shift += r;
+						continue;
+					}
+					double __y = table.f[__i] + (table.f[__i + 1] - table.f[__i]) * __open_unit(__random_bits64(__g));
+					if(__y < exp(-__x)){
+						return __shift + __x;
+					}
+				}
+			}
+		};
+
+		// log gamma(x) for x > 0: Stirling's series from 7 up, shifted
+		// there by the recurrence below that. unlike lgamma it touches no
+		// global state, so it is safe in the parallel fills.
+		inline double __log_gamma(double __x)
+		{
+			static const double __a[10] = {
+				8.333333333333333e-02, -2.777777777777778e-03,
+				7.936507936507937e-04, -5.952380952380952e-04,
+				8.417508417508418e-04, -1.917526917526918e-03,
+				6.410256410256410e-03, -2.955065359477124e-02,
+				1.796443723688307e-01, -1.39243221690590e+00};
+			if(__x == 1.0 || __x == 2.0){
+				return 0.0;
+			}
+			double __x0 = __x;
+			long __n = 0;
+			if(__x <= 7.0){
+				__n = (long)(7 - __x);
+				__x0 = __x + __n;
+			}
+			double __x2 = 1.0 / (__x0 * __x0);
+			double __gl0 = __a[9];
+			for(int __k = 8; __k >= 0; __k--){
+				__gl0 = __gl0 * __x2 + __a[__k];
+			}
+			// 0.5 log(2 pi)
+			double __gl = __gl0 / __x0 + 0.918938533204672742 + (__x0 - 0.5) * log(__x0) - __x0;
+			for(long __k = 0; __k < __n; __k++){
+				__x0 -= 1.0;
+				__gl -= log(__x0);
+			}
+			return __gl;
+		}
+
+		// fills [first, last) from d. distributions with a batch sampler
+		// give it as a generate(first, last, g) member, everything else is
+		// drawn one value at a time.
+		template <class _Distribution, class _ForwardIterator, class _URNG>
+		auto __generate(_Distribution& __d, _ForwardIterator __f, _ForwardIterator __l, _URNG& __g, int)
+			-> decltype(__d.generate(__f, __l, __g), void())
+		{
+			__d.generate(__f, __l, __g);
+		}
+
+		template <class _Distribution, class _ForwardIterator, class _URNG>
+		void __generate(_Distribution& __d, _ForwardIterator __f, _ForwardIterator __l, _URNG& __g, long)
+		{
+			for(; __f != __l; ++__f){
+				*__f = __d(__g);
+			}
+		}
+
+		template <class _Distribution, class _ForwardIterator, class _URNG>
+		void generate(_Distribution& __d, _ForwardIterator __f, _ForwardIterator __l, _URNG& __g)
+		{
+			x::random::__generate(__d, __f, __l, __g, 0);
+		}
+
+		// the high word of a 64 x 64 bit product, with the low word
+		// left in __lo
+		inline uint64_t __mul128(uint64_t __a, uint64_t __b, uint64_t& __lo)
+		{
+#if defined(__SIZEOF_INT128__)
+			unsigned __int128 __m = (unsigned __int128)__a * __b;
+			__lo = uint64_t(__m);
+			return uint64_t(__m >> 64);
+#else
+			uint64_t __al = uint32_t(__a), __ah = __a >> 32;
+			uint64_t __bl = uint32_t(__b), __bh = __b >> 32;
+			uint64_t __ll = __al * __bl, __lh = __al * __bh;
+			uint64_t __hl = __ah * __bl, __hh = __ah * __bh;
+			uint64_t __mid = (__ll >> 32) + uint32_t(__lh) + uint32_t(__hl);
+			__lo = (__mid << 32) | uint32_t(__ll);
+			return __hh + (__lh >> 32) + (__hl >> 32) + (__mid >> 32);
+#endif
+		}
+
+		// uniform int distribution
+		template<class _IntType = int>
+		class uniform_int_distribution
+		{
+		public:
+			//static constexpr const char * const desc_long = "";
+			static constexpr const char * const desc_short = "Produces random integers with equal probability in the range [a,b] (inclusive).";
+			static const int nparams = 2;
+			static constexpr const char * const param_a_desc = "Lower bound (inclusive)";
+			static constexpr const char * const param_b_desc = "Upper bound (inclusive)";
+			static constexpr const char * const param_desc_list[nparams] = {param_a_desc, param_b_desc};
+			struct x_param_validation validparams()
+			{
+				if(this->a() < this->b()){
+					return {true, ""};
+				}else{
+					return {false, "a < b"};
+				}
+			}
+
+			// types
+			typedef _IntType result_type;
+
+			class param_type
+			{
+				result_type __a_;
+				result_type __b_;
+				// the number of values, s = b - a + 1, which is 0 when
+				// the range is all 64 bits, and Lemire's threshold,
+				// 2^w mod s, below which the low word of the product
+				// is rejected. w is 32 when s fits in 32 bits, and
+				// then two draws can come from each engine word.
+				uint64_t __s_;
+				uint64_t __t_;
+				bool __narrow_;
+			public:
+				typedef uniform_int_distribution distribution_type;
+				explicit param_type(result_type __a = 0,
+						    result_type __b = std::numeric_limits<result_type>::max())
+					: __a_(__a), __b_(__b)
+				{
+					__s_ = uint64_t(__b) - uint64_t(__a) + 1;
+					__narrow_ = __s_ != 0 && __s_ <= (uint64_t(1) << 32);
+					if(__s_ == 0){
+						__t_ = 0;
+					}else if(__narrow_){
+						__t_ = uint32_t(-uint32_t(__s_)) % __s_;
+					}else{
+						__t_ = (-__s_) % __s_;
+					}
+				}
+				result_type a() const {return __a_;}
+				result_type b() const {return __b_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__a_ == __y.__a_ && __x.__b_ == __y.__b_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+
+				friend class uniform_int_distribution;
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit uniform_int_distribution(result_type __a = 0,
+							  result_type __b = std::numeric_limits<result_type>::max())
+				: __p_(param_type(__a, __b)) {}
+			explicit uniform_int_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p);
+
+			// fills [f, l) from a block of 64 bit engine words, two
+			// values to a word when the range fits in 32 bits. the
+			// draws are not those of repeated calls to operator().
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g)
+			{generate(__f, __l, __g, __p_);}
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p);
+
+			// property functions
+			result_type a() const {return __p_.a();}
+			result_type b() const {return __p_.b();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return a();}
+			result_type max() const {return b();}
+
+			friend bool operator==(const uniform_int_distribution& __x,
+					       const uniform_int_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const uniform_int_distribution& __x,
+					       const uniform_int_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
+			double pdf(double x) {return 1. / ((this->b() - this->a()) + 1);}
+			double cdf(double x) {return (floor(x) - this->a() + 1) / ((this->b() - this->a()) + 1);}
+			static constexpr bool meandef = 1;
+			double mean() {return (this->a() + this->b()) / 2.;}
+			static constexpr bool mediandef = 1;
+			double median() {return this->mean();}
+			static constexpr  bool modedef = false;
+			double mode() {return 0;}
+			static constexpr bool variancedef = 1;
+			double variance() {return (pow((this->b() - this->a()) + 1, 2.) - 1) / 12;}
+			static constexpr bool skewnessdef = 1;
+			double skewness() {return 0;}
+			static constexpr bool kurtosisdef = 1;
+			double kurtosis() {return -((6 * (pow((this->b() - this->a()) + 1, 2.) + 1)) / (5 * (pow((this->b() - this->a()) + 1, 2.) - 1)));}
+		};
+
+		// Lemire's multiply and shift, 2019: the high word of x s is
+		// uniform on [0, s) once products whose low word falls below
+		// 2^w mod s are thrown out, which is rare, and the threshold is
+		// worked out once per param_type, so there is no division at
+		// all. ranges that fit in 32 bits make 32 bit products from
+		// the top 32 bits of a word, one engine call per draw from 32
+		// and 64 bit engines.
+		template<class _IntType>
+		template<class _URNG>
+		_IntType
+		uniform_int_distribution<_IntType>::operator()(_URNG& __g, const param_type& __p)
+		{
+			const uint64_t __s = __p.__s_;
+			uint64_t __x;
+			if(__s == 0){
+				__x = __random_bits64(__g);
+			}else if(__p.__narrow_){
+				// __t_ is 2^32 mod s here, so the product has to be a
+				// 32 bit one whatever the width of the engine
+				uint64_t __m;
+				do{
+					__m = __random_bits<32>(__g) * __s;
+				}while(uint32_t(__m) < __p.__t_);
+				__x = __m >> 32;
+			}else{
+				uint64_t __lo;
+				do{
+					__x = __mul128(__random_bits64(__g), __s, __lo);
+				}while(__lo < __p.__t_);
+			}
+			return result_type(uint64_t(__p.__a_) + __x);
+		}
+
+		template<class _IntType>
+		template<class _ForwardIterator, class _URNG>
+		void
+		uniform_int_distribution<_IntType>::generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p)
+		{
+			const int __bs = 128;
+			uint64_t __w[__bs];
+			const uint64_t __a = uint64_t(__p.__a_), __s = __p.__s_, __t = __p.__t_;
+			size_t __n = std::distance(__f, __l);
+			while(__n > 0){
+				// no more words than the draws left need, so that the
+				// engine is not run past them
+				int __m;
+				if(__p.__narrow_){
+					__m = int(std::min<size_t>(__bs, (__n + 1) / 2));
+				}else{
+					__m = int(std::min<size_t>(__bs, __n));
+				}
+				for(int __i = 0; __i < __m; __i++){
+					__w[__i] = __random_bits64(__g);
+				}
+				if(__s == 0){
+					for(int __i = 0; __i < __m; __i++, ++__f){
+						*__f = result_type(__a + __w[__i]);
+					}
+					__n -= __m;
+				}else if(__p.__narrow_){
+					for(int __i = 0; __i < __m && __n > 0; __i++){
+						uint64_t __m0 = (__w[__i] >> 32) * __s;
+						if(uint32_t(__m0) >= __t){
+							*__f = result_type(__a + (__m0 >> 32));
+							++__f;
+							--__n;
+						}
+						uint64_t __m1 = uint32_t(__w[__i]) * __s;
+						if(__n > 0 && uint32_t(__m1) >= __t){
+							*__f = result_type(__a + (__m1 >> 32));
+							++__f;
+							--__n;
+						}
+					}
+				}else{
+					for(int __i = 0; __i < __m; __i++){
+						uint64_t __lo;
+						uint64_t __x = __mul128(__w[__i], __s, __lo);
+						if(__lo >= __t){
+							*__f = result_type(__a + __x);
+							++__f;
+							--__n;
+						}
+					}
+				}
+			}
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const uniform_int_distribution<_IT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left);
+			_CharT __sp = __os.widen(' ');
+			__os.fill(__sp);
+			return __os << __x.a() << __sp << __x.b();
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   uniform_int_distribution<_IT>& __x)
+		{
+			typedef uniform_int_distribution<_IT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __a;
+			result_type __b;
+			__is >> __a >> __b;
+			if (!__is.fail())
+				__x.param(param_type(__a, __b));
+			return __is;
+		}
+
+		// uniform real distribution
+		template<class _RealType = double>
+		class uniform_real_distribution
+		{
+		public:
+			//static constexpr const char * const desc_long = "";
+			static constexpr const char * const desc_short = "Produces random numbers in the range [a,b) where all intervals of the same length are equally probable.";
+			static const int nparams = 2;
+			static constexpr const char * const param_a_desc = "Lower bound (inclusive)";
+			static constexpr const char * const param_b_desc = "Upper bound (inclusive)";
+			static constexpr const char * const param_desc_list[nparams] = {param_a_desc, param_b_desc};
+			struct x_param_validation validparams()
+			{
+				if(this->a() < this->b()){
+					return {true, ""};
+				}else{
+					return {false, "a < b"};
+				}
+			}
+
+			// types
+			typedef _RealType result_type;
+
+			class param_type
+			{
+				result_type __a_;
+				result_type __b_;
+			public:
+				typedef uniform_real_distribution distribution_type;
+				explicit param_type(result_type __a = 0, result_type __b = 1)
+					: __a_(__a), __b_(__b) {}
+				result_type a() const {return __a_;}
+				result_type b() const {return __b_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__a_ == __y.__a_ && __x.__b_ == __y.__b_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit uniform_real_distribution(result_type __a = 0, result_type __b = 1)
+				: __p_(param_type(__a, __b)) {}
+			explicit uniform_real_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions. the engine words a draw takes
+			// follow __uniform_bits, so a uniform_bits_engine<32, ...>
+			// takes one word a draw from 32 bit engines
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p)
+			{return __p.a() + (__p.b() - __p.a()) * __canonical<result_type>(__g);}
+
+			// property functions
+			result_type a() const {return __p_.a();}
+			result_type b() const {return __p_.b();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return a();}
+			result_type max() const {return b();}
+
+			friend bool operator==(const uniform_real_distribution& __x,
+					       const uniform_real_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const uniform_real_distribution& __x,
+					       const uniform_real_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
+			double pdf(double x) {return 0;}
+			double cdf(double x) {return 0;}
+			static constexpr bool meandef = 1;
+			double mean() {return 0;}
+			static constexpr bool mediandef = 1;
+			double median() {return 0;}
+			static constexpr  bool modedef = 1;
+			double mode() {return 0;}
+			static constexpr bool variancedef = 1;
+			double variance() {return 0;}
+			static constexpr bool skewnessdef = 1;
+			double skewness() {return 0;}
+			static constexpr bool kurtosisdef = 1;
+			double kurtosis() {return 0;}
+		};
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const uniform_real_distribution<_RT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			_CharT __sp = __os.widen(' ');
+			__os.fill(__sp);
+			return __os << __x.a() << __sp << __x.b();
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   uniform_real_distribution<_RT>& __x)
+		{
+			typedef uniform_real_distribution<_RT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __a;
+			result_type __b;
+			__is >> __a >> __b;
+			if (!__is.fail())
+				__x.param(param_type(__a, __b));
+			return __is;
+		}
+
+		
+		// bernoulli distribution. a trial succeeds when a uniform u is
+		// less than p, and u is compared with the binary expansion of p
+		// a bit at a time, stopping at the first bit where they differ.
+		// that takes two bits a trial on average, which the batch
+		// functions exploit by running 64 trials in the lanes of a word:
+		// each round draws a word and settles the lanes whose bit
+		// differs from p's, so a block of 64 costs about log2(64) + 1
+		// words rather than 64 uniforms. when the expansion of p ends
+		// (p = 1/2 ends after one bit) every lane still undecided has
+		// u >= p and fails.
+		template <typename _IntType = int>
+		class bernoulli_distribution
+		{
+		public:
+			//static constexpr const char * const desc_long = "";
+			static constexpr const char * const desc_short = "Produces a 1 with probability p, and 0 with probability 1-p. Simulates a coin toss.";
+			static const int nparams = 1;
+			static constexpr const char * const param_p_desc = "Probability of success";
+			static constexpr const char * const param_desc_list[nparams] = {param_p_desc};
+			struct x_param_validation validparams()
+			{
+				if(this->p() >= 0 && this->p() <= 1){
+					return {true, ""};
+				}else{
+					return {false, "0 <= p <= 1"};
+				}
+			}
+
+			// types
+			typedef bool result_type;
+
+			class param_type
+			{
+				double __p_;
+				// p = 0.[__z_ zeros][the 64 bits of __m_], __m_ with its
+				// top bit set, and __e_ the position one past the last
+				// one bit. p >= 1 has __e_ < 0.
+				uint64_t __m_;
+				int __z_;
+				int __e_;
+			public:
+				typedef bernoulli_distribution distribution_type;
+
+				explicit param_type(double __p = 0.5)
+					: __p_(__p)
+				{
+					__m_ = 0;
+					__z_ = 0;
+					__e_ = 0;
+					if(__p_ >= 1){
+						__e_ = -1;
+					}else if(__p_ > 0){
+						int __x;
+						double __f = frexp(__p_, &__x);
+						__m_ = uint64_t(ldexp(__f, 64));
+						__z_ = -__x;
+						int __tz = 0;
+						while(!((__m_ >> __tz) & 1)){
+							__tz++;
+						}
+						__e_ = __z_ + 64 - __tz;
+					}
+				}
+
+				double p() const {return __p_;}
+
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__p_ == __y.__p_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+
+			private:
+				// the 64 bits of the expansion of p that start at bit __k
+				uint64_t __word(int __k) const
+				{
+					int __s = __z_ - __k;
+					if(__s >= 64 || __s <= -64){
+						return 0;
+					}
+					return __s >= 0 ? __m_ >> __s : __m_ << -__s;
+				}
+
+				friend class bernoulli_distribution;
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit bernoulli_distribution(double __p = 0.5)
+				: __p_(param_type(__p)) {}
+			explicit bernoulli_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions. one engine word a trial, and a
+			// second only when the word matches the top of p.
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p)
+			{
+				if(__p.__e_ < 0){
+					return true;
+				}
+				constexpr int __w = __engine_bits<_URNG>();
+				for(int __k = 0; __k < __p.__e_; __k += __w){
+					uint64_t __t = __p.__word(__k) >> (64 - __w);
+					uint64_t __u = __random_bits<__w>(__g);
+					if(__u != __t){
+						return __u < __t;
+					}
+				}
+				return false;
+			}
+
+			// batch generating functions. sample_bits packs n trials
+			// into (n + 63) / 64 words, trial i in bit i % 64 of word
+			// i / 64, and clears the unused bits of the last word.
+			template<class _URNG>
+			void sample_bits(_URNG& __g, uint64_t *__out, size_t __n)
+			{sample_bits(__g, __out, __n, __p_);}
+			template<class _URNG>
+			void sample_bits(_URNG& __g, uint64_t *__out, size_t __n, const param_type& __p)
+			{
+				for(size_t __i = 0; __i < __n; __i += 64){
+					uint64_t __b = __block(__g, __p);
+					if(__n - __i < 64){
+						__b &= (uint64_t(1) << (__n - __i)) - 1;
+					}
+					*__out++ = __b;
+				}
+			}
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g)
+			{generate(__f, __l, __g, __p_);}
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p)
+			{
+				while(__f != __l){
+					uint64_t __b = __block(__g, __p);
+					for(int __j = 0; __j < 64 && __f != __l; ++__j, ++__f){
+						*__f = (__b >> __j) & 1;
+					}
+				}
+			}
+
+			// property functions
+			double p() const {return __p_.p();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return false;}
+			result_type max() const {return true;}
+
+			friend bool operator==(const bernoulli_distribution& __x,
+					       const bernoulli_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const bernoulli_distribution& __x,
+					       const bernoulli_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
+			double pdf(double x) {return 0;}
+			double cdf(double x) {return 0;}
+			static constexpr bool meandef = 1;
+			double mean() {return 0;}
+			static constexpr bool mediandef = 1;
+			double median() {return 0;}
+			static constexpr  bool modedef = 1;
+			double mode() {return 0;}
+			static constexpr bool variancedef = 1;
+			double variance() {return 0;}
+			static constexpr bool skewnessdef = 1;
+			double skewness() {return 0;}
+			static constexpr bool kurtosisdef = 1;
+			double kurtosis() {return 0;}
+
+		private:
+			// 64 trials, one a bit. __u holds the lanes still undecided:
+			// at a one bit of p the lanes that drew zero succeed, and at
+			// a zero bit the lanes that drew one fail.
+			template<class _URNG>
+			static uint64_t __block(_URNG& __g, const param_type& __p)
+			{
+				if(__p.__e_ < 0){
+					return ~uint64_t(0);
+				}
+				uint64_t __s = 0;
+				uint64_t __u = ~uint64_t(0);
+				for(int __k = 0; __k < __p.__e_ && __u; __k += 64){
+					uint64_t __t = __p.__word(__k);
+					int __m = __p.__e_ - __k < 64 ? __p.__e_ - __k : 64;
+					for(int __j = 63; __j > 63 - __m && __u; --__j){
+						uint64_t __r = __random_bits<64>(__g);
+						if((__t >> __j) & 1){
+							__s |= __u & ~__r;
+							__u &= __r;
+						}else{
+							__u &= ~__r;
+						}
+					}
+				}
+				return __s;
+			}
+		};
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const bernoulli_distribution<_IT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			return __os << __x.p();
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   bernoulli_distribution<_IT>& __x)
+		{
+			typedef bernoulli_distribution<_IT> _Eng;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			double __p;
+			__is >> __p;
+			if (!__is.fail())
+				__x.param(param_type(__p));
+			return __is;
+		}
+		// binomial by inversion of the cdf, Kachitvichyanukul and
+		// Schmeiser's BINV, 1988. it walks the pmf up from 0 and so costs
+		// O(np) and needs p <= 0.5. __lq is log(1 - p), which callers
+		// that draw repeatedly with the same p can work out once.
+		template<class _URNG>
+		long __binomial_inversion(_URNG& __g, long __n, double __p, double __lq)
+		{
+			const double __q = 1 - __p;
+			const double __qn = exp(__n * __lq);
+			const double __np = __n * __p;
+			// guards against the sum of the pmf rounding to less than u
+			const double __bound = std::min((double)__n, __np + 10 * sqrt(__np * __q + 1));
+			long __x = 0;
+			double __px = __qn;
+			double __u = __open_uniform(__g);
+			while(__u > __px){
+				__x++;
+				if(__x > __bound){
+					__x = 0;
+					__px = __qn;
+					__u = __open_uniform(__g);
+				}else{
+					__u -= __px;
+					__px = ((__n - __x + 1) * __p * __px) / (__x * __q);
+				}
+			}
+			return __x;
+		}
+
+		// binomial distribution
+		template<class _IntType = int>
+		class binomial_distribution
+		{
+		public:
+			//static constexpr const char * const desc_long = "";
+			static constexpr const char * const desc_short = "Produces random integers in the range [0,t], which represent the number of successes in t trials each with probability p.";
+			static const int nparams = 2;
+			static constexpr const char * const param_t_desc = "Number of trials";
+			static constexpr const char * const param_p_desc = "Probability of success";
+			static constexpr const char * const param_desc_list[nparams] = {param_t_desc, param_p_desc};
+			struct x_param_validation validparams()
+			{
+				if(this->t() < 0){
+					return {false, "t >= 0"};
+				}else if(this->p() < 0 || this->p() > 1){
+					return {false, "0 <= p <= 1"};
+				}else{
+					return {true, ""};
+				}
+			}
+
+			// types
+			typedef _IntType result_type;
+
+			class param_type
+			{
+				result_type __t_;
+				double __p_;
+				// r is the smaller of p and 1 - p; draws are made with r
+				// and flipped if p > 0.5
+				double __r_;
+				double __q_;
+				// log(1 - r) for inversion, when t * r < 30
+				double __lq_;
+				// BTPE's envelope: the triangle, parallelograms and
+				// exponential tails split at p1 < p2 < p3 < p4
+				bool __btpe_;
+				long __m_;
+				double __nrq_;
+				double __xm_, __xl_, __xr_;
+				double __c_, __laml_, __lamr_;
+				double __p1_, __p2_, __p3_, __p4_;
+			public:
+				typedef binomial_distribution distribution_type;
+				explicit param_type(result_type __t = 1, double __p = 0.5)
+					: __t_(__t), __p_(__p) {__init();}
+				result_type t() const {return __t_;}
+				double p() const {return __p_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__t_ == __y.__t_ && __x.__p_ == __y.__p_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+
+			private:
+				void __init();
+
+				friend class binomial_distribution;
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit binomial_distribution(result_type __t = 1, double __p = 0.5)
+				: __p_(param_type(__t, __p)) {}
+			explicit binomial_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p);
+
+			// property functions
+			result_type t() const {return __p_.t();}
+			double p() const {return __p_.p();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return 0;}
+			result_type max() const {return t();}
+
+			friend bool operator==(const binomial_distribution& __x,
+					       const binomial_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const binomial_distribution& __x,
+					       const binomial_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
@@ -270,6 +2692,163 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
+
+		template<class _IntType>
+		void
+		binomial_distribution<_IntType>::param_type::__init()
+		{
+			__r_ = std::min(__p_, 1 - __p_);
+			__q_ = 1 - __r_;
+			__lq_ = log1p(-__r_);
+			__btpe_ = __t_ * __r_ >= 30;
+			if(!__btpe_){
+				return;
+			}
+			const double __fm = __t_ * __r_ + __r_;
+			__m_ = (long)floor(__fm);
+			__nrq_ = __t_ * __r_ * __q_;
+			__p1_ = floor(2.195 * sqrt(__nrq_) - 4.6 * __q_) + 0.5;
+			__xm_ = __m_ + 0.5;
+			__xl_ = __xm_ - __p1_;
+			__xr_ = __xm_ + __p1_;
+			__c_ = 0.134 + 20.5 / (15.3 + __m_);
+			double __a = (__fm - __xl_) / (__fm - __xl_ * __r_);
+			__laml_ = __a * (1 + __a / 2);
+			__a = (__xr_ - __fm) / (__xr_ * __q_);
+			__lamr_ = __a * (1 + __a / 2);
+			__p2_ = __p1_ * (1 + 2 * __c_);
+			__p3_ = __p2_ + __c_ / __laml_;
+			__p4_ = __p3_ + __c_ / __lamr_;
+		}
+
+		// Kachitvichyanukul and Schmeiser's BTPE, 1988, for t * r >= 30,
+		// and inversion below that. the envelope is a triangle over the
+		// mode, two parallelograms beside it and exponential tails; most
+		// draws are accepted in the triangle without evaluating the pmf.
+		template<class _IntType>
+		template<class _URNG>
+		_IntType
+		binomial_distribution<_IntType>::operator()(_URNG& __g, const param_type& __p)
+		{
+			const long __n = __p.__t_;
+			if(__n == 0 || __p.__r_ == 0){
+				return __p.__p_ > 0.5 ? __p.__t_ : 0;
+			}
+			long __y;
+			if(!__p.__btpe_){
+				__y = __binomial_inversion(__g, __n, __p.__r_, __p.__lq_);
+			}else{
+				const double __r = __p.__r_, __q = __p.__q_;
+				const long __m = __p.__m_;
+				for(;;){
+					double __u = __open_uniform(__g) * __p.__p4_;
+					double __v = __open_uniform(__g);
+					if(__u <= __p.__p1_){
+						// triangle
+						__y = (long)floor(__p.__xm_ - __p.__p1_ * __v + __u);
+						break;
+					}
+					if(__u <= __p.__p2_){
+						// parallelograms
+						double __x = __p.__xl_ + (__u - __p.__p1_) / __p.__c_;
+						__v = __v * __p.__c_ + 1 - fabs(__m - __x + 0.5) / __p.__p1_;
+						if(__v > 1){
+							continue;
+						}
+						__y = (long)floor(__x);
+					}else if(__u <= __p.__p3_){
+						// left tail
+						__y = (long)floor(__p.__xl_ + log(__v) / __p.__laml_);
+						if(__y < 0){
+							continue;
+						}
+						__v = __v * (__u - __p.__p2_) * __p.__laml_;
+					}else{
+						// right tail
+						__y = (long)floor(__p.__xr_ - log(__v) / __p.__lamr_);
+						if(__y > __n){
+							continue;
+						}
+						__v = __v * (__u - __p.__p3_) * __p.__lamr_;
+					}
+					long __k = std::labs(__y - __m);
+					if(__k <= 20 || __k >= __p.__nrq_ / 2 - 1){
+						// the pmf ratio f(y) / f(m) by recursion
+						const double __s = __r / __q;
+						const double __a = __s * (__n + 1);
+						double __f = 1;
+						if(__m < __y){
+							for(long __i = __m + 1; __i <= __y; __i++){
+								__f *= __a / __i - __s;
+							}
+						}else if(__m > __y){
+							for(long __i = __y + 1; __i <= __m; __i++){
+								__f /= __a / __i - __s;
+							}
+						}
+						if(__v <= __f){
+							break;
+						}
+						continue;
+					}
+					// squeeze, and failing that Stirling's formula
+					const double __nrq = __p.__nrq_;
+					const double __rho = (__k / __nrq) * ((__k * (__k / 3. + 0.625) + 0.16666666666666666) / __nrq + 0.5);
+					const double __t = -__k * (double)__k / (2 * __nrq);
+					const double __A = log(__v);
+					if(__A < __t - __rho){
+						break;
+					}
+					if(__A > __t + __rho){
+						continue;
+					}
+					const double __x1 = __y + 1, __f1 = __m + 1, __z = __n + 1 - __m, __w = __n - __y + 1;
+					const double __x2 = __x1 * __x1, __f2 = __f1 * __f1, __z2 = __z * __z, __w2 = __w * __w;
+					if(__A <= __p.__xm_ * log(__f1 / __x1)
+					   + (__n - __m + 0.5) * log(__z / __w)
+					   + (__y - __m) * log(__w * __r / (__x1 * __q))
+					   + (13680. - (462. - (132. - (99. - 140. / __f2) / __f2) / __f2) / __f2) / __f1 / 166320.
+					   + (13680. - (462. - (132. - (99. - 140. / __z2) / __z2) / __z2) / __z2) / __z / 166320.
+					   + (13680. - (462. - (132. - (99. - 140. / __x2) / __x2) / __x2) / __x2) / __x1 / 166320.
+					   + (13680. - (462. - (132. - (99. - 140. / __w2) / __w2) / __w2) / __w2) / __w / 166320.){
+						break;
+					}
+				}
+			}
+			return result_type(__p.__p_ > 0.5 ? __n - __y : __y);
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const binomial_distribution<_IT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			_CharT __sp = __os.widen(' ');
+			__os.fill(__sp);
+			return __os << __x.t() << __sp << __x.p();
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   binomial_distribution<_IT>& __x)
+		{
+			typedef binomial_distribution<_IT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __t;
+			double __p;
+			__is >> __t >> __p;
+			if (!__is.fail())
+				__x.param(param_type(__t, __p));
+			return __is;
+		}
+
 		template <typename IntType = int>
 		//using geometric_distribution = std::geometric_distribution<IntType>;
 		class geometric_distribution : public std::geometric_distribution<IntType>
@@ -344,12 +2923,11 @@ namespace x
 			double kurtosis() {return 0;}
 		};
 		
-		template <typename IntType = int>
-		//using poisson_distribution = std::poisson_distribution<IntType>;
-		class poisson_distribution : public std::poisson_distribution<IntType>
+		// poisson distribution
+		template<class _IntType = int>
+		class poisson_distribution
 		{
 		public:
-			using std::poisson_distribution<IntType>::poisson_distribution;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Produces random integers which represent the number of events that occurred during a fixed interval with mean rate of events.";
 			static const int nparams = 1;
@@ -363,11 +2941,80 @@ namespace x
 					return {true, ""};
 				}
 			}
-			
+
+			// types
+			typedef _IntType result_type;
+
+			class param_type
+			{
+				double __mean_;
+				// exp(-mean) for inversion, when mean < 10
+				double __emean_;
+				// Hörmann's PTRS constants
+				bool __ptrs_;
+				double __loglam_;
+				double __a_, __b_, __vr_, __loginvalpha_;
+			public:
+				typedef poisson_distribution distribution_type;
+				explicit param_type(double __mean = 1.0)
+					: __mean_(__mean)
+				{
+					__emean_ = exp(-__mean);
+					__ptrs_ = __mean >= 10;
+					if(!__ptrs_){
+						return;
+					}
+					__loglam_ = log(__mean);
+					__b_ = 0.931 + 2.53 * sqrt(__mean);
+					__a_ = -0.059 + 0.02483 * __b_;
+					__vr_ = 0.9277 - 3.6224 / (__b_ - 2);
+					__loginvalpha_ = log(1.1239 + 1.1328 / (__b_ - 3.4));
+				}
+				double mean() const {return __mean_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__mean_ == __y.__mean_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+
+				friend class poisson_distribution;
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit poisson_distribution(double __mean = 1.0)
+				: __p_(param_type(__mean)) {}
+			explicit poisson_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p);
+
+			// property functions
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return 0;}
+			result_type max() const {return std::numeric_limits<result_type>::max();}
+
+			friend bool operator==(const poisson_distribution& __x,
+					       const poisson_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const poisson_distribution& __x,
+					       const poisson_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
-			double mean() {return 0;}
+			double mean() {return __p_.mean();}
 			static constexpr bool mediandef = 1;
 			double median() {return 0;}
 			static constexpr  bool modedef = 1;
@@ -379,12 +3026,87 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
-		template <typename RealType = double>
-		//using exponential_distribution = std::exponential_distribution<RealType>;
-		class exponential_distribution : public std::exponential_distribution<RealType>
+
+		// Hörmann's PTRS, transformed rejection with squeeze, 1993, for
+		// mean >= 10, and inversion below that
+		template<class _IntType>
+		template<class _URNG>
+		_IntType
+		poisson_distribution<_IntType>::operator()(_URNG& __g, const param_type& __p)
+		{
+			const double __lam = __p.__mean_;
+			if(!(__lam > 0)){
+				return 0;
+			}
+			if(!__p.__ptrs_){
+				// guards against the sum of the pmf rounding to less than u
+				const double __bound = __lam + 10 * sqrt(__lam) + 10;
+				for(;;){
+					double __u = __open_uniform(__g);
+					double __px = __p.__emean_;
+					double __s = __px;
+					long __x = 0;
+					while(__u > __s && __x < __bound){
+						__x++;
+						__px *= __lam / __x;
+						__s += __px;
+					}
+					if(__u <= __s){
+						return result_type(__x);
+					}
+				}
+			}
+			const double __a = __p.__a_, __b = __p.__b_;
+			for(;;){
+				double __u = __open_uniform(__g) - 0.5;
+				double __v = __open_uniform(__g);
+				double __us = 0.5 - fabs(__u);
+				long __k = (long)floor((2 * __a / __us + __b) * __u + __lam + 0.43);
+				if(__us >= 0.07 && __v <= __p.__vr_){
+					return result_type(__k);
+				}
+				if(__k < 0 || (__us < 0.013 && __v > __us)){
+					continue;
+				}
+				if(log(__v) + __p.__loginvalpha_ - log(__a / (__us * __us) + __b)
+				   <= -__lam + __k * __p.__loglam_ - __log_gamma(__k + 1.)){
+					return result_type(__k);
+				}
+			}
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const poisson_distribution<_IT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			return __os << __x.param().mean();
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   poisson_distribution<_IT>& __x)
+		{
+			typedef poisson_distribution<_IT> _Eng;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			double __mean;
+			__is >> __mean;
+			if (!__is.fail())
+				__x.param(param_type(__mean));
+			return __is;
+		}
+
+		// exponential distribution
+		template<class _RealType = double>
+		class exponential_distribution
 		{
 		public:
-			using std::exponential_distribution<RealType>::exponential_distribution;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Produces random numbers which represent the interval between two independant events defined by a constant average rate of occurrence (lambda).";
 			static const int nparams = 1;
@@ -398,7 +3120,58 @@ namespace x
 					return {true, ""};
 				}
 			}
-			
+
+			// types
+			typedef _RealType result_type;
+
+			class param_type
+			{
+				result_type __lambda_;
+			public:
+				typedef exponential_distribution distribution_type;
+				explicit param_type(result_type __lambda = 1)
+					: __lambda_(__lambda) {}
+				result_type lambda() const {return __lambda_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__lambda_ == __y.__lambda_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit exponential_distribution(result_type __lambda = 1)
+				: __p_(param_type(__lambda)) {}
+			explicit exponential_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p)
+			{return result_type(__ziggurat_exponential::sample(__g) / __p.lambda());}
+
+			// property functions
+			result_type lambda() const {return __p_.lambda();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return 0;}
+			result_type max() const {return std::numeric_limits<result_type>::infinity();}
+
+			friend bool operator==(const exponential_distribution& __x,
+					       const exponential_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const exponential_distribution& __x,
+					       const exponential_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
@@ -414,12 +3187,40 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
-		template <typename RealType = double>
-		//using gamma_distribution = std::gamma_distribution<RealType>;
-		class gamma_distribution : public std::gamma_distribution<RealType>
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const exponential_distribution<_RT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			return __os << __x.lambda();
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   exponential_distribution<_RT>& __x)
+		{
+			typedef exponential_distribution<_RT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __lambda;
+			__is >> __lambda;
+			if (!__is.fail())
+				__x.param(param_type(__lambda));
+			return __is;
+		}
+
+		// gamma distribution
+		template<class _RealType = double>
+		class gamma_distribution
 		{
 		public:
-			using std::gamma_distribution<RealType>::gamma_distribution;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Produces random numbers which are the sum of alpha exponential distributions, each with beta as its parameter.";
 			static const int nparams = 2;
@@ -436,7 +3237,85 @@ namespace x
 					return {true, ""};
 				}
 			}
-			
+
+			// types
+			typedef _RealType result_type;
+
+			class param_type
+			{
+				result_type __alpha_;
+				result_type __beta_;
+				// Marsaglia and Tsang's d = a - 1/3 and c = 1 / sqrt(9d),
+				// where a is alpha, or alpha + 1 for the boosted draw
+				// when alpha < 1
+				double __d_;
+				double __c_;
+				double __inv_alpha_;
+			public:
+				typedef gamma_distribution distribution_type;
+				explicit param_type(result_type __alpha = 1, result_type __beta = 1)
+					: __alpha_(__alpha), __beta_(__beta)
+				{
+					double __a = __alpha < 1 ? __alpha + 1. : __alpha;
+					__d_ = __a - 1. / 3.;
+					__c_ = 1. / sqrt(9. * __d_);
+					__inv_alpha_ = 1. / __alpha;
+				}
+				result_type alpha() const {return __alpha_;}
+				result_type beta() const {return __beta_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__alpha_ == __y.__alpha_ && __x.__beta_ == __y.__beta_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+
+				friend class gamma_distribution;
+			};
+
+		private:
+			param_type __p_;
+
+			template<class _URNG>
+			static double __marsaglia_tsang(_URNG& __g, double __d, double __c);
+			template<class _URNG>
+			static double __boost(_URNG& __g, double __y, double __inv_alpha);
+
+		public:
+			// constructors and reset functions
+			explicit gamma_distribution(result_type __alpha = 1, result_type __beta = 1)
+				: __p_(param_type(__alpha, __beta)) {}
+			explicit gamma_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG> result_type operator()(_URNG& __g, const param_type& __p);
+
+			// batch generating functions
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g)
+			{generate(__f, __l, __g, __p_);}
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p);
+
+			// property functions
+			result_type alpha() const {return __p_.alpha();}
+			result_type beta() const {return __p_.beta();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return 0;}
+			result_type max() const {return std::numeric_limits<result_type>::infinity();}
+
+			friend bool operator==(const gamma_distribution& __x,
+					       const gamma_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const gamma_distribution& __x,
+					       const gamma_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
@@ -452,6 +3331,116 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
+
+		// standard gamma(a) for a >= 1 by Marsaglia and Tsang, 2000: d v
+		// with v = (1 + c z)^3, accepted by the polynomial squeeze almost
+		// every time and by the log test otherwise
+		template <class _RealType>
+		template<class _URNG>
+		double
+		gamma_distribution<_RealType>::__marsaglia_tsang(_URNG& __g, double __d, double __c)
+		{
+			while(true){
+				double __x, __v;
+				do{
+					__x = __ziggurat_normal::sample(__g);
+					__v = 1 + __c * __x;
+				}while(__v <= 0);
+				__v = __v * __v * __v;
+				double __u = __open_uniform(__g);
+				double __x2 = __x * __x;
+				if(__u < 1 - 0.0331 * __x2 * __x2){
+					return __d * __v;
+				}
+				if(log(__u) < 0.5 * __x2 + __d * (1 - __v + log(__v))){
+					return __d * __v;
+				}
+			}
+		}
+
+		// gamma(alpha) = gamma(alpha + 1) u^(1 / alpha) for alpha < 1. in
+		// log space -log u is a standard exponential, which saves the pow
+		// and keeps u^(1 / alpha) from underflowing on its own for small
+		// alpha.
+		template <class _RealType>
+		template<class _URNG>
+		double
+		gamma_distribution<_RealType>::__boost(_URNG& __g, double __y, double __inv_alpha)
+		{
+			return exp(log(__y) - __ziggurat_exponential::sample(__g) * __inv_alpha);
+		}
+
+		template <class _RealType>
+		template<class _URNG>
+		_RealType
+		gamma_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
+		{
+			if(__p.__alpha_ == 1){
+				return result_type(__p.__beta_ * __ziggurat_exponential::sample(__g));
+			}
+			double __y = __marsaglia_tsang(__g, __p.__d_, __p.__c_);
+			if(__p.__alpha_ < 1){
+				__y = __boost(__g, __y, __p.__inv_alpha_);
+			}
+			return result_type(__p.__beta_ * __y);
+		}
+
+		// same draws as repeated calls to operator(), with the branch on
+		// alpha taken once for the whole range
+		template <class _RealType>
+		template<class _ForwardIterator, class _URNG>
+		void
+		gamma_distribution<_RealType>::generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p)
+		{
+			const double __b = __p.__beta_, __d = __p.__d_, __c = __p.__c_;
+			if(__p.__alpha_ == 1){
+				for(; __f != __l; ++__f){
+					*__f = result_type(__b * __ziggurat_exponential::sample(__g));
+				}
+			}else if(__p.__alpha_ < 1){
+				const double __ia = __p.__inv_alpha_;
+				for(; __f != __l; ++__f){
+					*__f = result_type(__b * __boost(__g, __marsaglia_tsang(__g, __d, __c), __ia));
+				}
+			}else{
+				for(; __f != __l; ++__f){
+					*__f = result_type(__b * __marsaglia_tsang(__g, __d, __c));
+				}
+			}
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const gamma_distribution<_RT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			_CharT __sp = __os.widen(' ');
+			__os.fill(__sp);
+			__os << __x.alpha() << __sp << __x.beta();
+			return __os;
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   gamma_distribution<_RT>& __x)
+		{
+			typedef gamma_distribution<_RT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __alpha;
+			result_type __beta;
+			__is >> __alpha >> __beta;
+			if (!__is.fail())
+				__x.param(param_type(__alpha, __beta));
+			return __is;
+		}
+
 		template <typename RealType = double>
 		//using weibull_distribution = std::weibull_distribution<RealType>;
 		class weibull_distribution : public std::weibull_distribution<RealType>
@@ -528,12 +3517,11 @@ namespace x
 			double kurtosis() {return 0;}
 		};
 
-		template <typename RealType = double>
-		//using normal_distribution = std::normal_distribution<RealType>;
-		class normal_distribution : public std::normal_distribution<RealType>
+		// normal distribution
+		template<class _RealType = double>
+		class normal_distribution
 		{
 		public:
-			using std::normal_distribution<RealType>::normal_distribution;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Produces normally distributed random values around a mean.";
 			static const int nparams = 2;
@@ -548,11 +3536,65 @@ namespace x
 					return {true, ""};
 				}
 			}
-			
+
+			// types
+			typedef _RealType result_type;
+
+			class param_type
+			{
+				result_type __mean_;
+				result_type __stddev_;
+			public:
+				typedef normal_distribution distribution_type;
+				explicit param_type(result_type __mean = 0, result_type __stddev = 1)
+					: __mean_(__mean), __stddev_(__stddev) {}
+				result_type mean() const {return __mean_;}
+				result_type stddev() const {return __stddev_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__mean_ == __y.__mean_ && __x.__stddev_ == __y.__stddev_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit normal_distribution(result_type __mean = 0, result_type __stddev = 1)
+				: __p_(param_type(__mean, __stddev)) {}
+			explicit normal_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p)
+			{return result_type(__p.mean() + __p.stddev() * __ziggurat_normal::sample(__g));}
+
+			// property functions
+			result_type stddev() const {return __p_.stddev();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return -std::numeric_limits<result_type>::infinity();}
+			result_type max() const {return std::numeric_limits<result_type>::infinity();}
+
+			friend bool operator==(const normal_distribution& __x,
+					       const normal_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const normal_distribution& __x,
+					       const normal_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
-			double mean() {return 0;}
+			// doubles as the property function
+			result_type mean() const {return __p_.mean();}
 			static constexpr bool mediandef = 1;
 			double median() {return 0;}
 			static constexpr  bool modedef = 1;
@@ -564,12 +3606,44 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
-		template <typename RealType = double>
-		//using lognormal_distribution = std::lognormal_distribution<RealType>;
-		class lognormal_distribution : public std::lognormal_distribution<RealType>
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const normal_distribution<_RT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			_CharT __sp = __os.widen(' ');
+			__os.fill(__sp);
+			__os << __x.mean() << __sp << __x.stddev();
+			return __os;
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   normal_distribution<_RT>& __x)
+		{
+			typedef normal_distribution<_RT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __mean;
+			result_type __stddev;
+			__is >> __mean >> __stddev;
+			if (!__is.fail())
+				__x.param(param_type(__mean, __stddev));
+			return __is;
+		}
+
+		// lognormal distribution
+		template<class _RealType = double>
+		class lognormal_distribution
 		{
 		public:
-			using std::lognormal_distribution<RealType>::lognormal_distribution;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Produces numbers from a random variable, the logarathim of which is normally distributed.";
 			static const int nparams = 2;
@@ -584,7 +3658,61 @@ namespace x
 					return {true, ""};
 				}
 			}
-			
+
+			// types
+			typedef _RealType result_type;
+
+			class param_type
+			{
+				result_type __m_;
+				result_type __s_;
+			public:
+				typedef lognormal_distribution distribution_type;
+				explicit param_type(result_type __m = 0, result_type __s = 1)
+					: __m_(__m), __s_(__s) {}
+				result_type m() const {return __m_;}
+				result_type s() const {return __s_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__m_ == __y.__m_ && __x.__s_ == __y.__s_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit lognormal_distribution(result_type __m = 0, result_type __s = 1)
+				: __p_(param_type(__m, __s)) {}
+			explicit lognormal_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p)
+			{return result_type(exp(__p.m() + __p.s() * __ziggurat_normal::sample(__g)));}
+
+			// property functions
+			result_type m() const {return __p_.m();}
+			result_type s() const {return __p_.s();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return 0;}
+			result_type max() const {return std::numeric_limits<result_type>::infinity();}
+
+			friend bool operator==(const lognormal_distribution& __x,
+					       const lognormal_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const lognormal_distribution& __x,
+					       const lognormal_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
@@ -600,12 +3728,44 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
-		template <typename RealType = double>
-		//using chi_squared_distribution = std::chi_squared_distribution<RealType>;
-		class chi_squared_distribution : public std::chi_squared_distribution<RealType>
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const lognormal_distribution<_RT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			_CharT __sp = __os.widen(' ');
+			__os.fill(__sp);
+			__os << __x.m() << __sp << __x.s();
+			return __os;
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   lognormal_distribution<_RT>& __x)
+		{
+			typedef lognormal_distribution<_RT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __m;
+			result_type __s;
+			__is >> __m >> __s;
+			if (!__is.fail())
+				__x.param(param_type(__m, __s));
+			return __is;
+		}
+
+		// chi_squared distribution
+		template<class _RealType = double>
+		class chi_squared_distribution
 		{
 		public:
-			using std::chi_squared_distribution<RealType>::chi_squared_distribution;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Produces random numbers from the sum of the squares of k independent normal random variables.";
 			static const int nparams = 1;
@@ -619,7 +3779,59 @@ namespace x
 					return {true, ""};
 				}
 			}
-			
+
+			// types
+			typedef _RealType result_type;
+
+			class param_type
+			{
+				result_type __n_;
+				typename gamma_distribution<result_type>::param_type __gp_;
+			public:
+				typedef chi_squared_distribution distribution_type;
+				explicit param_type(result_type __n = 1)
+					: __n_(__n), __gp_(__n / 2, 2) {}
+				result_type n() const {return __n_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__n_ == __y.__n_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+
+				friend class chi_squared_distribution;
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit chi_squared_distribution(result_type __n = 1)
+				: __p_(param_type(__n)) {}
+			explicit chi_squared_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG> result_type operator()(_URNG& __g, const param_type& __p);
+
+			// property functions
+			result_type n() const {return __p_.n();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return 0;}
+			result_type max() const {return std::numeric_limits<result_type>::infinity();}
+
+			friend bool operator==(const chi_squared_distribution& __x,
+					       const chi_squared_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const chi_squared_distribution& __x,
+					       const chi_squared_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
@@ -635,6 +3847,50 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
+
+		template <class _RealType>
+		template<class _URNG>
+		_RealType
+		chi_squared_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
+		{
+			// one degree of freedom comes straight off the normal
+			// ziggurat, the rest is 2 gamma(n / 2)
+			if(__p.__n_ == 1){
+				double __z = __ziggurat_normal::sample(__g);
+				return result_type(__z * __z);
+			}
+			gamma_distribution<result_type> __gd;
+			return __gd(__g, __p.__gp_);
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const chi_squared_distribution<_RT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			return __os << __x.n();
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   chi_squared_distribution<_RT>& __x)
+		{
+			typedef chi_squared_distribution<_RT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __n;
+			__is >> __n;
+			if (!__is.fail())
+				__x.param(param_type(__n));
+			return __is;
+		}
+
 		template <typename RealType = double>
 		//using cauchy_distribution = std::cauchy_distribution<RealType>;
 		class cauchy_distribution : public std::cauchy_distribution<RealType>
@@ -693,6 +3949,22 @@ namespace x
 					return {true, ""};
 				}
 			}
+
+			// the ratio of two chi-squared draws, taken here since
+			// libstdc++ scales it by the distribution's own m and n
+			// when it is handed other parameters
+			template<class _URNG>
+			RealType operator()(_URNG& __g)
+			{return (*this)(__g, this->param());}
+			template<class _URNG>
+			RealType operator()(_URNG& __g, const typename std::fisher_f_distribution<RealType>::param_type& __p)
+			{
+				typedef typename gamma_distribution<RealType>::param_type __gp;
+				gamma_distribution<RealType> __gd;
+				RealType __x = __gd(__g, __gp(__p.m() * RealType(.5)));
+				RealType __y = __gd(__g, __gp(__p.n() * RealType(.5)));
+				return __x * __p.n() / (__y * __p.m());
+			}
 			
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
@@ -709,12 +3981,11 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
-		template <typename RealType = double>
-		//using student_t_distribution = std::student_t_distribution<RealType>;
-		class student_t_distribution : public std::student_t_distribution<RealType>
+		// student_t distribution
+		template<class _RealType = double>
+		class student_t_distribution
 		{
 		public:
-			using std::student_t_distribution<RealType>::student_t_distribution;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Produces random values which approach a standard normal distribution as n (the sample size) increases.";
 			static const int nparams = 1;
@@ -728,7 +3999,59 @@ namespace x
 					return {true, ""};
 				}
 			}
-			
+
+			// types
+			typedef _RealType result_type;
+
+			class param_type
+			{
+				result_type __n_;
+				typename gamma_distribution<result_type>::param_type __gp_;
+			public:
+				typedef student_t_distribution distribution_type;
+				explicit param_type(result_type __n = 1)
+					: __n_(__n), __gp_(__n / 2, 2) {}
+				result_type n() const {return __n_;}
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__n_ == __y.__n_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+
+				friend class student_t_distribution;
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructors and reset functions
+			explicit student_t_distribution(result_type __n = 1)
+				: __p_(param_type(__n)) {}
+			explicit student_t_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG> result_type operator()(_URNG& __g, const param_type& __p);
+
+			// property functions
+			result_type n() const {return __p_.n();}
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+			result_type min() const {return -std::numeric_limits<result_type>::infinity();}
+			result_type max() const {return std::numeric_limits<result_type>::infinity();}
+
+			friend bool operator==(const student_t_distribution& __x,
+					       const student_t_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const student_t_distribution& __x,
+					       const student_t_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
@@ -745,12 +4068,118 @@ namespace x
 			double kurtosis() {return 0;}
 		};
 
-		template <typename IntType = int>
-		//using discrete_distribution = std::discrete_distribution<IntType>;
-		class discrete_distribution : public std::discrete_distribution<IntType>
+		template <class _RealType>
+		template<class _URNG>
+		_RealType
+		student_t_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
+		{
+			// z / sqrt(chi^2_n / n), with chi^2_n = 2 gamma(n / 2)
+			gamma_distribution<result_type> __gd;
+			double __z = __ziggurat_normal::sample(__g);
+			return result_type(__z * sqrt(__p.__n_ / __gd(__g, __p.__gp_)));
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const student_t_distribution<_RT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			return __os << __x.n();
+		}
+
+		template <class _CharT, class _Traits, class _RT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   student_t_distribution<_RT>& __x)
+		{
+			typedef student_t_distribution<_RT> _Eng;
+			typedef typename _Eng::result_type result_type;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			result_type __n;
+			__is >> __n;
+			if (!__is.fail())
+				__x.param(param_type(__n));
+			return __is;
+		}
+
+		// Walker's alias table, built by Vose's method, 1991. each of
+		// the n columns holds a threshold and an alias; a draw picks a
+		// column and a height in it from one 64 bit word and returns the
+		// column or its alias, so sampling is O(1) whatever n is. the
+		// build is O(n) and happens once per set of weights.
+		class __alias_table
+		{
+			struct __entry
+			{
+				double __q_;
+				size_t __a_;
+			};
+			std::vector<__entry> __t_;
+		public:
+			// p must be normalized
+			void __build(const std::vector<double>& __p)
+			{
+				size_t __n = __p.size();
+				__t_.resize(__n);
+				// small columns stack up from the front of __w, large
+				// ones down from the back
+				std::vector<size_t> __w(__n);
+				size_t __ns = 0, __nl = __n;
+				for(size_t __i = 0; __i < __n; __i++){
+					__t_[__i].__q_ = __p[__i] * __n;
+					__t_[__i].__a_ = __i;
+					if(__t_[__i].__q_ < 1){
+						__w[__ns++] = __i;
+					}else{
+						__w[--__nl] = __i;
+					}
+				}
+				while(__ns > 0 && __nl < __n){
+					size_t __s = __w[--__ns];
+					size_t __l = __w[__nl++];
+					__t_[__s].__a_ = __l;
+					// Vose's ordering of the subtraction loses less
+					__t_[__l].__q_ = (__t_[__l].__q_ + __t_[__s].__q_) - 1;
+					if(__t_[__l].__q_ < 1){
+						__w[__ns++] = __l;
+					}else{
+						__w[--__nl] = __l;
+					}
+				}
+				// whatever is left is full up to rounding
+				for(size_t __i = 0; __i < __ns; __i++){
+					__t_[__w[__i]].__q_ = 1;
+				}
+				for(size_t __i = __nl; __i < __n; __i++){
+					__t_[__w[__i]].__q_ = 1;
+				}
+			}
+
+			size_t size() const {return __t_.size();}
+
+			template<class _URNG>
+			size_t operator()(_URNG& __g) const
+			{
+				size_t __n = __t_.size();
+				double __u = (__random_bits64(__g) >> 11) * (1.0 / 9007199254740992.0) * __n;
+				size_t __i = (size_t)__u;
+				if(__i >= __n){
+					__i = __n - 1;
+				}
+				return __u - __i < __t_[__i].__q_ ? __i : __t_[__i].__a_;
+			}
+		};
+
+		// discrete distribution
+		template<class _IntType = int>
+		class discrete_distribution
 		{
 		public:
-			using std::discrete_distribution<IntType>::discrete_distribution;
 			//static constexpr const char * const desc_long = "";
 			static constexpr const char * const desc_short = "Produces random values according to a list of n non-negative weights.";
 			static const int nparams = 1;
@@ -769,7 +4198,101 @@ namespace x
 					return {true, ""};
 				}
 			}
-			
+
+			// types
+			typedef _IntType result_type;
+
+			class param_type
+			{
+				std::vector<double> __p_;
+				__alias_table __t_;
+			public:
+				typedef discrete_distribution distribution_type;
+
+				param_type() {__init();}
+				template<class _InputIterator>
+				param_type(_InputIterator __f, _InputIterator __l)
+					: __p_(__f, __l) {__init();}
+#ifndef _LIBCPP_CXX03_LANG
+				param_type(std::initializer_list<double> __wl)
+					: __p_(__wl.begin(), __wl.end()) {__init();}
+#endif  // _LIBCPP_CXX03_LANG
+				template<class _UnaryOperation>
+				param_type(size_t __nw, double __xmin, double __xmax,
+					   _UnaryOperation __fw);
+
+				std::vector<double> probabilities() const {return __p_;}
+
+				friend bool operator==(const param_type& __x, const param_type& __y)
+				{return __x.__p_ == __y.__p_;}
+				friend bool operator!=(const param_type& __x, const param_type& __y)
+				{return !(__x == __y);}
+
+			private:
+				void __init();
+
+				friend class discrete_distribution;
+			};
+
+		private:
+			param_type __p_;
+
+		public:
+			// constructor and reset functions
+			discrete_distribution() {}
+			template<class _InputIterator>
+			discrete_distribution(_InputIterator __f, _InputIterator __l)
+				: __p_(__f, __l) {}
+#ifndef _LIBCPP_CXX03_LANG
+			discrete_distribution(std::initializer_list<double> __wl)
+				: __p_(__wl) {}
+#endif  // _LIBCPP_CXX03_LANG
+			template<class _UnaryOperation>
+			discrete_distribution(size_t __nw, double __xmin, double __xmax,
+					      _UnaryOperation __fw)
+				: __p_(__nw, __xmin, __xmax, __fw) {}
+			explicit discrete_distribution(const param_type& __p)
+				: __p_(__p) {}
+			void reset() {}
+
+			// generating functions
+			template<class _URNG>
+			result_type operator()(_URNG& __g)
+			{return (*this)(__g, __p_);}
+			template<class _URNG>
+			result_type operator()(_URNG& __g, const param_type& __p)
+			{return result_type(__p.__t_(__g));}
+
+			// batch generating functions
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g)
+			{generate(__f, __l, __g, __p_);}
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p)
+			{
+				const __alias_table& __t = __p.__t_;
+				for(; __f != __l; ++__f){
+					*__f = result_type(__t(__g));
+				}
+			}
+
+			// property functions
+			std::vector<double> probabilities() const {return __p_.probabilities();}
+
+			param_type param() const {return __p_;}
+			void param(const param_type& __p) {__p_ = __p;}
+
+			result_type min() const {return 0;}
+			result_type max() const {return __p_.__p_.size() - 1;}
+
+			friend bool operator==(const discrete_distribution& __x,
+					       const discrete_distribution& __y)
+			{return __x.__p_ == __y.__p_;}
+			friend bool operator!=(const discrete_distribution& __x,
+					       const discrete_distribution& __y)
+			{return !(__x == __y);}
+
+			// characterization functions
 			double pdf(double x) {return 0;}
 			double cdf(double x) {return 0;}
 			static constexpr bool meandef = 1;
@@ -785,6 +4308,81 @@ namespace x
 			static constexpr bool kurtosisdef = 1;
 			double kurtosis() {return 0;}
 		};
+
+		template<class _IntType>
+		template<class _UnaryOperation>
+		discrete_distribution<_IntType>::param_type::param_type(size_t __nw,
+								      double __xmin,
+								      double __xmax,
+								      _UnaryOperation __fw)
+		{
+			if (__nw > 1)
+				{
+					__p_.reserve(__nw);
+					double __d = (__xmax - __xmin) / __nw;
+					double __d2 = __d / 2;
+					for (size_t __k = 0; __k < __nw; ++__k)
+						__p_.push_back(__fw(__xmin + __k * __d + __d2));
+				}
+			__init();
+		}
+
+		// normalizes the weights, as std::discrete_distribution does,
+		// and rebuilds the alias table
+		template<class _IntType>
+		void
+		discrete_distribution<_IntType>::param_type::__init()
+		{
+			if(__p_.size() < 2){
+				__p_.assign(1, 1.0);
+			}else{
+				double __s = 0;
+				for(size_t __i = 0; __i < __p_.size(); __i++){
+					__s += __p_[__i];
+				}
+				for(size_t __i = 0; __i < __p_.size(); __i++){
+					__p_[__i] /= __s;
+				}
+			}
+			__t_.__build(__p_);
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_ostream<_CharT, _Traits>&
+		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+			   const discrete_distribution<_IT>& __x)
+		{
+			std::__save_flags<_CharT, _Traits> __lx(__os);
+			__os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::fixed |
+				   std::ios_base::scientific);
+			_CharT __sp = __os.widen(' ');
+			__os.fill(__sp);
+			std::vector<double> __p = __x.probabilities();
+			__os << __p.size();
+			for (size_t __i = 0; __i < __p.size(); ++__i)
+				__os << __sp << __p[__i];
+			return __os;
+		}
+
+		template <class _CharT, class _Traits, class _IT>
+		std::basic_istream<_CharT, _Traits>&
+		operator>>(std::basic_istream<_CharT, _Traits>& __is,
+			   discrete_distribution<_IT>& __x)
+		{
+			typedef discrete_distribution<_IT> _Eng;
+			typedef typename _Eng::param_type param_type;
+			std::__save_flags<_CharT, _Traits> __lx(__is);
+			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			size_t __n;
+			__is >> __n;
+			std::vector<double> __p(__n);
+			for (size_t __i = 0; __i < __n; ++__i)
+				__is >> __p[__i];
+			if (!__is.fail())
+				__x.param(param_type(__p.begin(), __p.end()));
+			return __is;
+		}
+
 		template <typename RealType = double>
 		//using piecewise_constant_distribution = std::piecewise_constant_distribution<RealType>;
 		class piecewise_constant_distribution : public std::piecewise_constant_distribution<RealType>
@@ -887,21 +4485,78 @@ namespace x
 			{
 				result_type __alpha_;
 				result_type __beta_;
+				// Johnk's method when both shapes are below 1, and
+				// otherwise Cheng's BC when the smaller is at most 1 and
+				// BB when it is above. Cheng, Generating beta variates
+				// with nonintegral shape parameters, 1978.
+				enum {__johnk, __bc, __bb} __method_;
+				// Cheng's a and b: the smaller and larger shape for BB,
+				// the larger and smaller for BC. a variate is w / (b + w),
+				// or b / (b + w) when a is not alpha.
+				double __a_;
+				double __b_;
+				bool __flip_;
+				// a + b and the scale of the logistic proposal; for BB
+				// also a + 1 / __s_, and for BC Cheng's k1 and k2. Johnk
+				// keeps 1 / alpha and 1 / beta in __s_ and __c0_.
+				double __ab_;
+				double __s_;
+				double __c0_;
+				double __c1_;
 			public:
 				typedef beta_distribution distribution_type;
 				explicit param_type(result_type __alpha = 1, result_type __beta = 1)
-					: __alpha_(__alpha), __beta_(__beta) {}
+					: __alpha_(__alpha), __beta_(__beta)
+				{
+					double __lo = std::min<double>(__alpha, __beta);
+					double __hi = std::max<double>(__alpha, __beta);
+					__ab_ = __lo + __hi;
+					__c1_ = 0;
+					if(__hi < 1){
+						__method_ = __johnk;
+						__a_ = __alpha;
+						__b_ = __beta;
+						__flip_ = false;
+						__s_ = 1. / __alpha;
+						__c0_ = 1. / __beta;
+					}else if(__lo <= 1){
+						__method_ = __bc;
+						__a_ = __hi;
+						__b_ = __lo;
+						__flip_ = __a_ != __alpha;
+						__s_ = 1. / __b_;
+						double __d = 1 + __a_ - __b_;
+						__c0_ = __d * (0.0138889 + 0.0416667 * __b_) / (__a_ * __s_ - 0.777778);
+						__c1_ = 0.25 + (0.5 + 0.25 / __d) * __b_;
+					}else{
+						__method_ = __bb;
+						__a_ = __lo;
+						__b_ = __hi;
+						__flip_ = __a_ != __alpha;
+						__s_ = sqrt((__ab_ - 2) / (2 * __a_ * __b_ - __ab_));
+						__c0_ = __a_ + 1 / __s_;
+					}
+				}
 				result_type alpha() const {return __alpha_;}
 				result_type beta() const {return __beta_;}
 				friend bool operator==(const param_type& __x, const param_type& __y)
 				{return __x.__alpha_ == __y.__alpha_ && __x.__beta_ == __y.__beta_;}
 				friend bool operator!=(const param_type& __x, const param_type& __y)
 				{return !(__x == __y);}
+
+				friend class beta_distribution;
 			};
 
 		private:
 			param_type __p_;
 
+			template<class _URNG>
+			static double __johnk_sample(_URNG& __g, const param_type& __p);
+			template<class _URNG>
+			static double __bc_sample(_URNG& __g, const param_type& __p);
+			template<class _URNG>
+			static double __bb_sample(_URNG& __g, const param_type& __p);
+
 		public:
 			// constructors and reset functions
 			explicit beta_distribution(result_type __alpha = 1, result_type __beta = 1)
@@ -916,6 +4571,32 @@ namespace x
 			{return (*this)(__g, __p_);}
 			template<class _URNG> result_type operator()(_URNG& __g, const param_type& __p);
 
+			// batch generating functions. the method is picked once for
+			// the whole range.
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g)
+			{generate(__f, __l, __g, __p_);}
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p)
+			{
+				switch(__p.__method_){
+				case param_type::__johnk:
+					for(; __f != __l; ++__f){
+						*__f = result_type(__johnk_sample(__g, __p));
+					}
+					break;
+				case param_type::__bc:
+					for(; __f != __l; ++__f){
+						*__f = result_type(__bc_sample(__g, __p));
+					}
+					break;
+				default:
+					for(; __f != __l; ++__f){
+						*__f = result_type(__bb_sample(__g, __p));
+					}
+				}
+			}
+
 			// property functions
 			result_type alpha() const {return __p_.alpha();}
 			result_type beta() const {return __p_.beta();}
@@ -982,13 +4663,108 @@ namespace x
 
 		template <class _RealType>
 		template<class _URNG>
-		_RealType
-		beta_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
+		_RealType
+		beta_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
+		{
+			switch(__p.__method_){
+			case param_type::__johnk:
+				return result_type(__johnk_sample(__g, __p));
+			case param_type::__bc:
+				return result_type(__bc_sample(__g, __p));
+			default:
+				return result_type(__bb_sample(__g, __p));
+			}
+		}
+
+		// Johnk: x = u^(1 / alpha) and y = v^(1 / beta) are accepted when
+		// x + y <= 1, giving x / (x + y). done in logs, since x and y
+		// underflow for small shapes.
+		template <class _RealType>
+		template<class _URNG>
+		double
+		beta_distribution<_RealType>::__johnk_sample(_URNG& __g, const param_type& __p)
+		{
+			for(;;){
+				double __lx = log(__open_uniform(__g)) * __p.__s_;
+				double __ly = log(__open_uniform(__g)) * __p.__c0_;
+				double __lm = std::max(__lx, __ly);
+				double __ls = __lm + log(exp(__lx - __lm) + exp(__ly - __lm));
+				if(__ls <= 0){
+					return exp(__lx - __ls);
+				}
+			}
+		}
+
+		// the logistic proposal of BB and BC, w = a e^v, kept finite
+		inline double __beta_w(double __a, double __v)
 		{
-			gamma_distribution<result_type> g1(__p.alpha(), 1.);
-			gamma_distribution<result_type> g2(__p.beta(), 1.);
-			result_type a = g1(__g);
-			return a / (a + g2(__g));
+			return __v > 709 ? std::numeric_limits<double>::max() : __a * exp(__v);
+		}
+
+		template <class _RealType>
+		template<class _URNG>
+		double
+		beta_distribution<_RealType>::__bc_sample(_URNG& __g, const param_type& __p)
+		{
+			const double __a = __p.__a_, __b = __p.__b_;
+			double __w;
+			for(;;){
+				double __u1 = __open_uniform(__g);
+				double __u2 = __open_uniform(__g);
+				double __z;
+				if(__u1 < 0.5){
+					double __y = __u1 * __u2;
+					__z = __u1 * __y;
+					if(0.25 * __u2 + __z - __y >= __p.__c0_){
+						continue;
+					}
+				}else{
+					__z = __u1 * __u1 * __u2;
+					if(__z <= 0.25){
+						__w = __beta_w(__a, __p.__s_ * log(__u1 / (1 - __u1)));
+						break;
+					}
+					if(__z >= __p.__c1_){
+						continue;
+					}
+				}
+				double __v = __p.__s_ * log(__u1 / (1 - __u1));
+				__w = __beta_w(__a, __v);
+				if(__p.__ab_ * (log(__p.__ab_ / (__b + __w)) + __v) - 1.3862944 >= log(__z)){
+					break;
+				}
+			}
+			return __p.__flip_ ? __b / (__b + __w) : __w / (__b + __w);
+		}
+
+		template <class _RealType>
+		template<class _URNG>
+		double
+		beta_distribution<_RealType>::__bb_sample(_URNG& __g, const param_type& __p)
+		{
+			const double __a = __p.__a_, __b = __p.__b_;
+			double __w;
+			for(;;){
+				double __u1 = __open_uniform(__g);
+				double __u2 = __open_uniform(__g);
+				double __v = __p.__s_ * log(__u1 / (1 - __u1));
+				__w = __beta_w(__a, __v);
+				double __z = __u1 * __u1 * __u2;
+				double __r = __p.__c0_ * __v - 1.3862944;
+				double __s = __a + __r - __w;
+				// the squeeze, then the exact test
+				if(__s + 2.609438 >= 5 * __z){
+					break;
+				}
+				double __t = log(__z);
+				if(__s > __t){
+					break;
+				}
+				if(__r + __p.__ab_ * log(__p.__ab_ / (__b + __w)) >= __t){
+					break;
+				}
+			}
+			return __p.__flip_ ? __b / (__b + __w) : __w / (__b + __w);
 		}
 
 		// kumaraswamy distribution
@@ -1155,6 +4931,9 @@ namespace x
 			class param_type
 			{
 				std::vector<double> __p_;
+				// one gamma per concentration, so their constants are
+				// worked out once rather than on every draw
+				std::vector<typename gamma_distribution<_RealType>::param_type> __gp_;
 			public:
 				typedef dirichlet_distribution distribution_type;
 				param_type() {}
@@ -1288,6 +5067,11 @@ namespace x
 		void
 		dirichlet_distribution<_RealType>::param_type::__init()
 		{
+			__gp_.clear();
+			__gp_.reserve(__p_.size());
+			for(size_t __i = 0; __i < __p_.size(); __i++){
+				__gp_.emplace_back(__p_[__i], 1.0);
+			}
 			// if (!__p_.empty())
 			// 	{
 			// 		if (__p_.size() > 1)
@@ -1328,14 +5112,12 @@ namespace x
 		std::vector<_RealType>
 		dirichlet_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::vector<_RealType> alpha = __p.alpha();
-			size_t n = alpha.size();
+			size_t n = __p.__gp_.size();
 			std::vector<_RealType> vec(n);
 			_RealType sum = 0;
+			gamma_distribution<_RealType> d;
 			for(size_t i = 0; i < n; i++){
-				gamma_distribution<_RealType> d(alpha[i], 1.0);
-				
-				vec[i] = d(__g);
+				vec[i] = d(__g, __p.__gp_[i]);
 				sum += vec[i];
 			}
 			for(size_t i = 0; i < n; i++){
@@ -1377,8 +5159,10 @@ namespace x
 			std::vector<double> __p(__n);
 			for (size_t __i = 0; __i < __n; ++__i)
 				__is >> __p[__i];
-			if (!__is.fail())
+			if (!__is.fail()){
 				swap(__x.__p_.__p_, __p);
+				__x.__p_.__init();
+			}
 			return __is;
 		}
 
@@ -1412,10 +5196,31 @@ namespace x
 			{
 				result_type __n_ = 1;
 				std::vector<double> __p_;
+				// for n small against the number of categories it is
+				// cheaper to drop n items into bins through an alias
+				// table than to run a binomial per category
+				__alias_table __t_;
+				// the categories with nonzero probability, most likely
+				// first, each with its probability conditional on none
+				// of the ones before it, so that the conditional
+				// binomials use up n as early as possible. __r_ is the
+				// smaller of q and 1 - q and __lr_ is log(1 - __r_),
+				// which is all the setup binomial inversion needs.
+				struct __cond
+				{
+					size_t __i_;
+					double __q_;
+					double __r_;
+					double __lr_;
+				};
+				std::vector<__cond> __c_;
+				// the first binomial always has all n trials, so its BTPE
+				// setup is done once here
+				typename binomial_distribution<long>::param_type __b0_;
 			public:
 				typedef multinomial_distribution distribution_type;
 
-				param_type() : __p_({0.5, 0.5}) {}
+				param_type() : __p_({0.5, 0.5}) {__init();}
 				template<class _InputIterator>
 				param_type(result_type __n, _InputIterator __f, _InputIterator __l)
 					: __n_(__n), __p_(__f, __l) {__init();}
@@ -1456,6 +5261,9 @@ namespace x
 		private:
 			param_type __p_;
 
+			template<class _URNG, class _Function>
+			static void __conditional_binomials(_URNG& __g, const param_type& __p, _Function __f);
+
 		public:
 			// constructor and reset functions
 			multinomial_distribution() {}
@@ -1480,6 +5288,26 @@ namespace x
 			{return (*this)(__g, __p_);}
 			template<class _URNG> std::vector<result_type> operator()(_URNG& __g, const param_type& __p);
 
+			// writes one draw, a count for each of the p().size()
+			// categories, to __out without allocating, and returns the
+			// end of what it wrote
+			template<class _URNG, class _RandomAccessIterator>
+			_RandomAccessIterator sample(_URNG& __g, _RandomAccessIterator __out)
+			{return sample(__g, __out, __p_);}
+			template<class _URNG, class _RandomAccessIterator>
+			_RandomAccessIterator sample(_URNG& __g, _RandomAccessIterator __out, const param_type& __p);
+
+			// writes one draw as (index, count) pairs for the nonzero
+			// counts only, in no particular order, and returns how many
+			// it wrote. __idx and __cnt need room for min(n, p().size())
+			// entries. for n much smaller than the number of categories
+			// this costs O(n log n) rather than O(p().size()).
+			template<class _URNG, class _IndexIterator, class _CountIterator>
+			size_t sample_sparse(_URNG& __g, _IndexIterator __idx, _CountIterator __cnt)
+			{return sample_sparse(__g, __idx, __cnt, __p_);}
+			template<class _URNG, class _IndexIterator, class _CountIterator>
+			size_t sample_sparse(_URNG& __g, _IndexIterator __idx, _CountIterator __cnt, const param_type& __p);
+
 			// property functions
 			result_type n() const {return __p_.n();}
 			std::vector<double> p() const {return __p_.p();}
@@ -1550,6 +5378,36 @@ namespace x
 		void
 		multinomial_distribution<_IntType>::param_type::__init()
 		{
+			double __s = 0;
+			for(size_t __i = 0; __i < __p_.size(); __i++){
+				__s += __p_[__i];
+			}
+			__c_.clear();
+			__t_ = __alias_table();
+			if(!(__s > 0)){
+				return;
+			}
+			std::vector<double> __q(__p_.size());
+			for(size_t __i = 0; __i < __p_.size(); __i++){
+				__q[__i] = __p_[__i] / __s;
+				if(__q[__i] > 0){
+					__c_.push_back({__i, __q[__i], 0, 0});
+				}
+			}
+			__t_.__build(__q);
+			std::stable_sort(__c_.begin(), __c_.end(),
+					 [](const __cond& __a, const __cond& __b){return __a.__q_ > __b.__q_;});
+			// the mass left from each category on, summed from the
+			// small end
+			double __rest = 0;
+			for(size_t __j = __c_.size(); __j-- > 0;){
+				__rest += __c_[__j].__q_;
+				double __c = __j + 1 == __c_.size() ? 1.0 : std::min(1.0, __c_[__j].__q_ / __rest);
+				__c_[__j].__q_ = __c;
+				__c_[__j].__r_ = std::min(__c, 1 - __c);
+				__c_[__j].__lr_ = log1p(-__c_[__j].__r_);
+			}
+			__b0_ = typename binomial_distribution<long>::param_type(__n_, __c_[0].__r_);
 			// result_type __sum = _VSTD::accumulate(__p_.begin(),
 			// 				      __p_.end(),
 			// 				      result_type());
@@ -1596,33 +5454,102 @@ namespace x
 		std::vector<_IntType>
 		multinomial_distribution<_IntType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::vector<double> p = __p.p();
-			long pn = p.size();
-			long n = __p.n();
-			std::vector<result_type> r(pn);
-			std::fill(r.begin(), r.end(), 0);
-			double norm = 0;
-			long n_sum = 0;
-			double p_sum = 0;
-			for(long i = 0; i < pn; i++){
-				norm += p[i];
-			}
-			for(long i = 0; i < pn; i++){
-				if(p[i] > 0){
-					double pp = 1.0;
-					if(i < pn - 1){
-						pp = p[i] / (norm - p_sum);
-					}
-					binomial_distribution<_IntType> d(n - n_sum, pp);
-					r[i] = d(__g);
-				}
-				n_sum += r[i];
-				p_sum += p[i];
-				if(n_sum == n){
-					break;
+			std::vector<result_type> r(__p.__p_.size());
+			sample(__g, r.begin(), __p);
+			return r;
+		}
+
+		// one binomial per category in order of decreasing probability,
+		// each conditional on the categories before it, stopping once
+		// all n are placed. means below binomial_distribution's BTPE
+		// cutoff of 30 go by inversion with log(1 - r) cached in the
+		// param_type, and the first category, which always has all n
+		// trials, uses the BTPE setup cached there. later categories
+		// get the count left by the ones before, which changes from
+		// draw to draw, so their BTPE setup can't be cached; with the
+		// categories sorted, few of them have a mean of 30 or more.
+		template<class _IntType>
+		template<class _URNG, class _Function>
+		void
+		multinomial_distribution<_IntType>::__conditional_binomials(_URNG& __g, const param_type& __p, _Function __f)
+		{
+			long __n = __p.__n_;
+			for(size_t __j = 0; __j < __p.__c_.size() && __n > 0; __j++){
+				const typename param_type::__cond& __c = __p.__c_[__j];
+				long __x;
+				if(__c.__q_ >= 1){
+					__x = __n;
+				}else{
+					if(__n * __c.__r_ < 30){
+						__x = __binomial_inversion(__g, __n, __c.__r_, __c.__lr_);
+					}else if(__j == 0){
+						__x = binomial_distribution<long>()(__g, __p.__b0_);
+					}else{
+						binomial_distribution<long> __d(__n, __c.__r_);
+						__x = __d(__g);
+					}
+					if(__c.__r_ != __c.__q_){
+						__x = __n - __x;
+					}
+				}
+				if(__x > 0){
+					__f(__c.__i_, __x);
+					__n -= __x;
 				}
 			}
-			return r;
+		}
+
+		template<class _IntType>
+		template<class _URNG, class _RandomAccessIterator>
+		_RandomAccessIterator
+		multinomial_distribution<_IntType>::sample(_URNG& __g, _RandomAccessIterator __out, const param_type& __p)
+		{
+			const long __k = __p.__p_.size();
+			const long __n = __p.__n_;
+			std::fill(__out, __out + __k, 0);
+			if(__n < __k && __p.__t_.size() == (size_t)__k){
+				for(long __i = 0; __i < __n; __i++){
+					++__out[__p.__t_(__g)];
+				}
+			}else{
+				__conditional_binomials(__g, __p, [&__out](size_t __i, long __x){__out[__i] = __x;});
+			}
+			return __out + __k;
+		}
+
+		template<class _IntType>
+		template<class _URNG, class _IndexIterator, class _CountIterator>
+		size_t
+		multinomial_distribution<_IntType>::sample_sparse(_URNG& __g, _IndexIterator __idx, _CountIterator __cnt, const param_type& __p)
+		{
+			const long __k = __p.__p_.size();
+			const long __n = __p.__n_;
+			size_t __m = 0;
+			if(__n < __k && __p.__t_.size() == (size_t)__k){
+				// drop the n items into __idx, sort them, and count
+				// the runs in place
+				for(long __i = 0; __i < __n; __i++){
+					__idx[__i] = __p.__t_(__g);
+				}
+				std::sort(__idx, __idx + __n);
+				for(long __i = 0; __i < __n;){
+					long __j = __i + 1;
+					while(__j < __n && __idx[__j] == __idx[__i]){
+						__j++;
+					}
+					__idx[__m] = __idx[__i];
+					__cnt[__m] = __j - __i;
+					__m++;
+					__i = __j;
+				}
+			}else{
+				__conditional_binomials(__g, __p, [&](size_t __i, long __x){
+						__idx[__m] = __i;
+						__cnt[__m] = __x;
+						__m++;
+					});
+			}
+			return __m;
 		}
 
 		template <class _CharT, class _Traits, class _IT>
@@ -1636,7 +5563,7 @@ namespace x
 			_CharT __sp = __os.widen(' ');
 			__os.fill(__sp);
 			size_t __n = __x.__p_.__p_.size();
-			__os << __n;
+			__os << __x.__p_.__n_ << __sp << __n;
 			for (size_t __i = 0; __i < __n; ++__i)
 				__os << __sp << __x.__p_.__p_[__i];
 			return __os;
@@ -1649,13 +5576,17 @@ namespace x
 		{
 			std::__save_flags<_CharT, _Traits> __lx(__is);
 			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			_IT __t;
 			size_t __n;
-			__is >> __n;
+			__is >> __t >> __n;
 			std::vector<double> __p(__n);
 			for (size_t __i = 0; __i < __n; ++__i)
 				__is >> __p[__i];
-			if (!__is.fail())
+			if (!__is.fail()){
+				__x.__p_.__n_ = __t;
 				swap(__x.__p_.__p_, __p);
+				__x.__p_.__init();
+			}
 			return __is;
 		}
 
@@ -1666,20 +5597,20 @@ namespace x
 		{
 		public:
 			//static constexpr const char * const desc_long = "";
-			static constexpr const char * const desc_short = "Produces random values that represent the probability of n successes in M trials given N objects of interest.";
+			static constexpr const char * const desc_short = "Produces random values that represent the number of objects of interest among n drawn without replacement from a population of N containing M of them.";
 			static const int nparams = 3;
-			static constexpr const char * const param_n_desc = "Number of successes";
-			static constexpr const char * const param_M_desc = "Population size";
-			static constexpr const char * const param_N_desc = "Number of objects of interest";
+			static constexpr const char * const param_n_desc = "Number of draws";
+			static constexpr const char * const param_M_desc = "Number of objects of interest";
+			static constexpr const char * const param_N_desc = "Population size";
 			static constexpr const char * const param_desc_list[nparams] = {param_n_desc, param_M_desc, param_N_desc};
 			struct x_param_validation validparams()
 			{
-				if(this->M() < 0){
-					return {false, "M >= 0"};
-				}else if(this->n() <= 0 || this->n() > this->M()){
-					return {false, "0 < n <= M"};
-				}else if(this->N() <= 0 || this->N() > this->M()){
-					return {false, "0 < N <= M"};
+				if(this->N() <= 0){
+					return {false, "N > 0"};
+				}else if(this->M() < 0 || this->M() > this->N()){
+					return {false, "0 <= M <= N"};
+				}else if(this->n() <= 0 || this->n() > this->N()){
+					return {false, "0 < n <= N"};
 				}else{
 					return {true, ""};
 				}
@@ -1691,6 +5622,19 @@ namespace x
 			class param_type
 			{
 				result_type __n_, __M_, __N_;
+				// the draw is made on the reduced problem of __m_ =
+				// min(n, N - n) draws with __k_ = min(M, N - M) of
+				// interest, whose support starts at 0, and mapped back
+				// by __flip_
+				enum {__constant, __inversion, __hrua} __method_;
+				long __m_, __k_;
+				bool __flip_k_, __flip_m_;
+				// inversion: P(0) and the top of the support
+				double __p0_;
+				long __max_;
+				// hrua: centre, scale, the log pmf at the mode with
+				// its sign flipped, and the cutoff
+				double __d6_, __d8_, __d10_, __d11_;
 			public:
 				typedef hypergeometric_distribution distribution_type;
 
@@ -1761,17 +5705,47 @@ namespace x
 
 		template<class _IntType>
 		hypergeometric_distribution<_IntType>::param_type::param_type(const result_type __n, const result_type __M, const result_type __N)
-			: __n_(__n), __M_(__M), __N_(__N)
+			: __n_(__n), __M_(__M), __N_(__N), __method_(__constant), __m_(0), __k_(0),
+			  __flip_k_(false), __flip_m_(false)
 		{
-			// if (0 < __p_ && __p_ < 1)
-			// 	{
-			// 		__r0_ = static_cast<result_type>((__t_ + 1) * __p_);
-			// 		__pr_ = _VSTD::exp(__libcpp_lgamma(__t_ + 1.) -
-			// 				   __libcpp_lgamma(__r0_ + 1.) -
-			// 				   __libcpp_lgamma(__t_ - __r0_ + 1.) + __r0_ * _VSTD::log(__p_) +
-			// 				   (__t_ - __r0_) * _VSTD::log(1 - __p_));
-			// 		__odds_ratio_ = __p_ / (1 - __p_);
-			// 	}
+			if(__N <= 0 || __M < 0 || __M > __N || __n < 0 || __n > __N){
+				// invalid, always 0
+				return;
+			}
+			long __N1 = __N;
+			__flip_k_ = __M > __N1 - __M;
+			__flip_m_ = __n > __N1 - __n;
+			__k_ = __flip_k_ ? __N1 - __M : __M;
+			__m_ = __flip_m_ ? __N1 - __n : __n;
+			__max_ = __m_ < __k_ ? __m_ : __k_;
+			double __mean = (double)__m_ * __k_ / __N1;
+			if(__max_ == 0){
+				__method_ = __constant;
+			}else if(__mean < 10){
+				// inversion costs about mean + 1 steps
+				__method_ = __inversion;
+				__p0_ = exp(__log_gamma(__N1 - __k_ + 1.) + __log_gamma(__N1 - __m_ + 1.)
+					    - __log_gamma(__N1 - __k_ - __m_ + 1.) - __log_gamma(__N1 + 1.));
+			}else{
+				// Stadlober's ratio of uniforms, 1989, with a constant
+				// number of expected trials
+				__method_ = __hrua;
+				const double __D1 = 1.7155277699214135; // 2 sqrt(2 / e)
+				const double __D2 = 0.8989161620588988; // 3 - 2 sqrt(3 / e)
+				double __d4 = (double)__k_ / __N1;
+				double __d5 = 1.0 - __d4;
+				__d6_ = __m_ * __d4 + 0.5;
+				double __d7 = sqrt((double)(__N1 - __m_) * __m_ * __d4 * __d5 / (__N1 - 1) + 0.5);
+				__d8_ = __D1 * __d7 + __D2;
+				long __d9 = (long)floor((double)(__m_ + 1) * (__k_ + 1) / (__N1 + 2));
+				__d10_ = __log_gamma(__d9 + 1.) + __log_gamma(__k_ - __d9 + 1.)
+					+ __log_gamma(__m_ - __d9 + 1.) + __log_gamma(__N1 - __k_ - __m_ + __d9 + 1.);
+				// 16 standard deviations is past anything a double can see
+				__d11_ = floor(__d6_ + 16 * __d7);
+				if(__max_ + 1.0 < __d11_){
+					__d11_ = __max_ + 1.0;
+				}
+			}
 		}
 
 		template<class _IntType>
@@ -1779,38 +5753,49 @@ namespace x
 		_IntType
 		hypergeometric_distribution<_IntType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			_IntType a = __p.M();
-			_IntType b = __p.N();
-			_IntType k = 0;
-			if(__p.n() > __p.N() / 2){
-				for(long i = 0; i < __p.n(); i++){
-					std::uniform_real_distribution d(0., 1.);
-					double r = d(__g);
-					if(b * r < a){
-						k++;
-						if(k == __p.M()){
-							return k;
-						}
-						a--;
-					}
-					b--;
+			long __z = 0;
+			if(__p.__method_ == param_type::__inversion){
+				// walk the pmf up from 0 with
+				// P(z + 1) / P(z) = (k - z)(m - z) / ((z + 1)(N - k - m + z + 1))
+				const long __k = __p.__k_, __m = __p.__m_, __r = __p.__N_ - __k - __m;
+				double __u = __open_uniform(__g);
+				double __pz = __p.__p0_;
+				while(__u > __pz && __z < __p.__max_){
+					__u -= __pz;
+					__pz *= (double)(__k - __z) * (__m - __z) / ((double)(__z + 1) * (__r + __z + 1));
+					__z++;
 				}
-				return k;
-			}else{
-				for(long i = 0; i < __p.N() - __p.n(); i++){
-					std::uniform_real_distribution d(0., 1.);
-					double r = d(__g);
-					if(b * r < a){
-						k++;
-						if(k == __p.M()){
-							return __p.M() - k;
-						}
-						a--;
+			}else if(__p.__method_ == param_type::__hrua){
+				const long __k = __p.__k_, __m = __p.__m_, __r = __p.__N_ - __k - __m;
+				while(true){
+					double __x = __open_uniform(__g);
+					double __y = __open_uniform(__g);
+					double __w = __p.__d6_ + __p.__d8_ * (__y - 0.5) / __x;
+					if(__w < 0.0 || __w >= __p.__d11_){
+						continue;
+					}
+					__z = (long)floor(__w);
+					double __t = __p.__d10_ - (__log_gamma(__z + 1.) + __log_gamma(__k - __z + 1.)
+								   + __log_gamma(__m - __z + 1.) + __log_gamma(__r + __z + 1.));
+					if(__x * (4.0 - __x) - 3.0 <= __t){
+						break;
+					}
+					if(__x * (__x - __t) >= 1){
+						continue;
+					}
+					if(2.0 * log(__x) <= __t){
+						break;
 					}
-					b--;
 				}
-				return __p.M() - k;
 			}
+			// back from the reduced problem
+			if(__p.__flip_k_){
+				__z = __p.__m_ - __z;
+			}
+			if(__p.__flip_m_){
+				__z = __p.__M_ - __z;
+			}
+			return _IntType(__z);
 		}
 
 		template <class _CharT, class _Traits, class _IntType>
@@ -1884,10 +5869,11 @@ namespace x
 			{
 				result_type __n_ = 1;
 				std::vector<result_type> __M_;
+				long __sum_ = 0;
 			public:
 				typedef multivariate_hypergeometric_distribution distribution_type;
 
-				param_type() : __M_({1, 1}) {}
+				param_type() : __M_({1, 1}) {__init();}
 				template<class _InputIterator>
 				param_type(result_type __n, _InputIterator __f, _InputIterator __l)
 					: __n_(__n), __M_(__f, __l) {__init();}
@@ -1952,6 +5938,15 @@ namespace x
 			{return (*this)(__g, __p_);}
 			template<class _URNG> std::vector<result_type> operator()(_URNG& __g, const param_type& __p);
 
+			// writes one draw, a count for each of the M().size()
+			// categories, to __out without allocating, and returns the
+			// end of what it wrote
+			template<class _URNG, class _OutputIterator>
+			_OutputIterator sample(_URNG& __g, _OutputIterator __out)
+			{return sample(__g, __out, __p_);}
+			template<class _URNG, class _OutputIterator>
+			_OutputIterator sample(_URNG& __g, _OutputIterator __out, const param_type& __p);
+
 			// property functions
 			result_type n() const {return __p_.n();}
 			std::vector<result_type> M() const {return __p_.M();}
@@ -2022,30 +6017,10 @@ namespace x
 		void
 		multivariate_hypergeometric_distribution<_IntType>::param_type::__init()
 		{
-			// result_type __sum = _VSTD::accumulate(__p_.begin(),
-			// 				      __p_.end(),
-			// 				      result_type());
-			// for(size_t __i = 0; __i < __p_.size(); ++__i){
-			// 	__p_[__i] /= __sum;
-			// }
-			// if (!__p_.empty())
-			// 	{
-			// 		if (__p_.size() > 1)
-			// 			{
-			// 				double __s = _VSTD::accumulate(__p_.begin(), __p_.end(), 0.0);
-			// 				for (_VSTD::vector<double>::iterator __i = __p_.begin(), __e = __p_.end();
-			// 				     __i < __e; ++__i)
-			// 					*__i /= __s;
-			// 				vector<double> __t(__p_.size() - 1);
-			// 				_VSTD::partial_sum(__p_.begin(), __p_.end() - 1, __t.begin());
-			// 				swap(__p_, __t);
-			// 			}
-			// 		else
-			// 			{
-			// 				__p_.clear();
-			// 				__p_.shrink_to_fit();
-			// 			}
-			// 	}
+			__sum_ = 0;
+			for(size_t __i = 0; __i < __M_.size(); __i++){
+				__sum_ += __M_[__i];
+			}
 		}
 
 		template<class _IntType>
@@ -2068,36 +6043,39 @@ namespace x
 		std::vector<_IntType>
 		multivariate_hypergeometric_distribution<_IntType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			_IntType n = __p.n();
-			std::vector<_IntType> M = __p.M();
-			std::vector<_IntType> M_cumsum(M.size());
-			std::vector<_IntType> m(M.size());
-			std::fill(m.begin(), m.end(), 0);
-			_IntType N = 0;
-			
-			for(int i = 0; i < M.size(); i++){
-				N += M[i];
-				M_cumsum[i] = N;
-			}
-			double b = N;
-			for(int i = 0; i < n; i++){
-				std::uniform_real_distribution d(0., 1.);
-				double u = d(__g);
-				u *= b;
-
-				for(int j = 0; j < M.size(); j++){
-					if(u < M_cumsum[j]){
-						M[j]--;
-						m[j]++;
-						for(int k = j; k < M.size(); k++){
-							M_cumsum[k]--;
-						}
-						break;
-					}
+			std::vector<_IntType> m(__p.__M_.size());
+			sample(__g, m.begin(), __p);
+			return m;
+		}
+
+		// the sequential conditional method: the count for category i is
+		// hypergeometric in the draws and population left over once the
+		// categories before it are settled, so a draw costs K univariate
+		// hypergeometric draws whatever n is
+		template<class _IntType>
+		template<class _URNG, class _OutputIterator>
+		_OutputIterator
+		multivariate_hypergeometric_distribution<_IntType>::sample(_URNG& __g, _OutputIterator __out, const param_type& __p)
+		{
+			typedef typename hypergeometric_distribution<long>::param_type __hp;
+			hypergeometric_distribution<long> __hd;
+			const size_t __k = __p.__M_.size();
+			long __n = __p.__n_;
+			long __N = __p.__sum_;
+			for(size_t __i = 0; __i < __k; __i++, ++__out){
+				long __x;
+				if(__n <= 0){
+					__x = 0;
+				}else if(__i + 1 == __k){
+					__x = __n;
+				}else{
+					__x = __hd(__g, __hp(__n, __p.__M_[__i], __N));
 				}
-				b--;
+				*__out = _IntType(__x);
+				__n -= __x;
+				__N -= __p.__M_[__i];
 			}
-			return m;
+			return __out;
 		}
 
 		template <class _CharT, class _Traits, class _IT>
@@ -2110,10 +6088,10 @@ namespace x
 				   std::ios_base::scientific);
 			_CharT __sp = __os.widen(' ');
 			__os.fill(__sp);
-			size_t __n = __x.__p_.__p_.size();
-			__os << __n;
+			size_t __n = __x.__p_.__M_.size();
+			__os << __x.__p_.__n_ << __sp << __n;
 			for (size_t __i = 0; __i < __n; ++__i)
-				__os << __sp << __x.__p_.__p_[__i];
+				__os << __sp << __x.__p_.__M_[__i];
 			return __os;
 		}
 
@@ -2124,13 +6102,17 @@ namespace x
 		{
 			std::__save_flags<_CharT, _Traits> __lx(__is);
 			__is.flags(std::ios_base::dec | std::ios_base::skipws);
+			_IT __t;
 			size_t __n;
-			__is >> __n;
-			std::vector<double> __p(__n);
+			__is >> __t >> __n;
+			std::vector<_IT> __M(__n);
 			for (size_t __i = 0; __i < __n; ++__i)
-				__is >> __p[__i];
-			if (!__is.fail())
-				swap(__x.__p_.__p_, __p);
+				__is >> __M[__i];
+			if (!__is.fail()){
+				__x.__p_.__n_ = __t;
+				swap(__x.__p_.__M_, __M);
+				__x.__p_.__init();
+			}
 			return __is;
 		}
 
@@ -2228,10 +6210,10 @@ namespace x
 		laplace_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
 			exponential_distribution<result_type> ed(1.);
-			std::uniform_real_distribution<result_type> ud(0, 1);
-			result_type u = ud(__g);
+			// the sign needs one bit, not a uniform
+			bool neg = __random_bits<1>(__g);
 			result_type x = ed(__g);
-			if(u < 0.5){
+			if(neg){
 				x = -x;
 			}
 			return __p.mu() + __p.sigma() * x;
@@ -2362,11 +6344,7 @@ namespace x
 		_RealType
 		rayleigh_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::uniform_real_distribution<result_type> d(0., 1.);
-			result_type u;
-			do{
-				u = d(__g);
-			}while(u == 0);
+			result_type u = __open_uniform(__g);
 			return __p.sigma() * sqrt(-2. * log(u));
 		}
 
@@ -2427,16 +6405,21 @@ namespace x
 			{
 				long __k_;
 				result_type __lambda_;
+				// gamma(k, 1 / lambda), used once k is large enough
+				// that one gamma draw beats k uniforms
+				typename gamma_distribution<result_type>::param_type __gp_;
 			public:
 				typedef erlang_distribution distribution_type;
 				explicit param_type(long __k = 1, result_type __lambda = 1)
-					: __k_(__k), __lambda_(__lambda) {}
+					: __k_(__k), __lambda_(__lambda), __gp_(__k, 1 / __lambda) {}
 				long k() const {return __k_;}
 				result_type lambda() const {return __lambda_;}
 				friend bool operator==(const param_type& __x, const param_type& __y)
 				{return __x.__k_ == __y.__k_ && __x.__lambda_ == __y.__lambda_;}
 				friend bool operator!=(const param_type& __x, const param_type& __y)
 				{return !(__x == __y);}
+
+				friend class erlang_distribution;
 			};
 
 		private:
@@ -2493,15 +6476,20 @@ namespace x
 		_RealType
 		erlang_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::uniform_real_distribution<result_type> d(0, 1);
-			long k = __p.k();
-			result_type product = 1.;
-			for(long i = 0; i < k; i++){
-				result_type u = 0.;
-				while((u = d(__g)) == 0.){}
-				product *= u;
+			// the product of k uniforms costs k draws and underflows for
+			// large k, so beyond a couple of factors a single gamma draw
+			// is both cheaper and exact
+			if(__p.__k_ >= 3){
+				gamma_distribution<result_type> __gd;
+				return __gd(__g, __p.__gp_);
+			}
+			// the sum of the logs, taken as the log of the product; each
+			// factor is at least 2^-54, so this few cannot underflow
+			double __prod = 1;
+			for(long __i = 0; __i < __p.__k_; __i++){
+				__prod *= __open_uniform(__g);
 			}
-			return (-1. / __p.lambda()) * log(product);
+			return result_type(-log(__prod) / __p.__lambda_);
 		}
 
 		template <class _CharT, class _Traits, class _RT>
@@ -2563,25 +6551,57 @@ namespace x
 			{
 				result_type __a_;
 				result_type __sigma_;
+				// s = a / sigma, the bound for the standard normal
+				double __s_;
+				// Robert's rate for an exponential proposal from s,
+				// (s + sqrt(s^2 + 4)) / 2
+				double __lambda_;
+				// for a table, the left edges of __table_size strips of
+				// equal probability, the quantiles of the tail at i / n,
+				// with f(x[i + 1]) / f(x[i]) for each to squeeze with, and
+				// the rate for the unbounded last strip
+				std::vector<double> __x_;
+				std::vector<double> __r_;
+				double __tail_lambda_;
 			public:
 				typedef gaussian_tail_distribution distribution_type;
-				explicit param_type(long __a = 1, result_type __sigma = 1)
-					: __a_(__a), __sigma_(__sigma) {}
+				static const size_t __table_size = 256;
+				// with __table set, the inverse cdf is tabulated up
+				// front, which pays off when many draws are made with
+				// the same parameters. it is ignored for a < 0.
+				explicit param_type(result_type __a = 1, result_type __sigma = 1, bool __table = false)
+					: __a_(__a), __sigma_(__sigma)
+				{
+					__s_ = __a / __sigma;
+					__lambda_ = (__s_ + sqrt(__s_ * __s_ + 4)) / 2;
+					if(__table){
+						__tabulate();
+					}
+				}
 				result_type a() const {return __a_;}
 				result_type sigma() const {return __sigma_;}
+				bool table() const {return !__x_.empty();}
 				friend bool operator==(const param_type& __x, const param_type& __y)
 				{return __x.__a_ == __y.__a_ && __x.__sigma_ == __y.__sigma_;}
 				friend bool operator!=(const param_type& __x, const param_type& __y)
 				{return !(__x == __y);}
+
+			private:
+				void __tabulate();
+
+				friend class gaussian_tail_distribution;
 			};
 
 		private:
 			param_type __p_;
 
+			template<class _URNG>
+			static double __exponential_tail(_URNG& __g, double __s, double __lambda);
+
 		public:
 			// constructors and reset functions
-			explicit gaussian_tail_distribution(long __a = 1, result_type __sigma = 1)
-				: __p_(param_type(__a, __sigma)) {}
+			explicit gaussian_tail_distribution(result_type __a = 1, result_type __sigma = 1, bool __table = false)
+				: __p_(param_type(__a, __sigma, __table)) {}
 			explicit gaussian_tail_distribution(const param_type& __p)
 				: __p_(__p) {}
 			void reset() {}
@@ -2629,27 +6649,102 @@ namespace x
 		_RealType
 		gaussian_tail_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::uniform_real_distribution<result_type> du(0, 1);
-			std::normal_distribution<result_type> dn(1.0);
-			result_type sigma = __p.sigma();
-			result_type adivsigma = __p.a() / __p.sigma();
-			if(adivsigma < 1){
-				double x = dn(__g);
-				while(x < adivsigma){
-					x = dn(__g);
+			const double __s = __p.__s_;
+			double __x;
+			if(!__p.__x_.empty()){
+				// pick a strip from the low bits and a point in it from
+				// the high ones, then accept under f, for the most part
+				// on the squeeze alone. the strips are equally likely,
+				// so a rejection retries in the same strip.
+				const std::vector<double>& __xt = __p.__x_;
+				const size_t __n = param_type::__table_size;
+				uint64_t __b = __random_bits64(__g);
+				const size_t __i = __b & (__n - 1);
+				if(__i == __n - 1){
+					__x = __exponential_tail(__g, __xt[__i], __p.__tail_lambda_);
+				}else{
+					const double __x0 = __xt[__i], __w = __xt[__i + 1] - __x0;
+					for(;;){
+						__x = __x0 + __w * __open_unit(__b);
+						double __v = __open_uniform(__g);
+						if(__v <= __p.__r_[__i] || log(__v) <= (__x0 - __x) * (__x0 + __x) / 2){
+							break;
+						}
+						__b = __random_bits64(__g);
+					}
 				}
-				return x * sigma;
-			}else{
-				double u, v, x;
+			}else if(__s < 0){
+				// at least half of the normal is above s
+				do{
+					__x = __ziggurat_normal::sample(__g);
+				}while(__x < __s);
+			}else if(__s < 0.8){
+				// at least 42% of the half normal is above s
 				do{
-					u = du(__g);
-					do{
-						v = du(__g);
-					}while(v == 0.);
-					x = sqrt(adivsigma * adivsigma - 2 * log(v));
-				}while(x * u > adivsigma);
-				return x * sigma;
+					__x = fabs(__ziggurat_normal::sample(__g));
+				}while(__x < __s);
+			}else{
+				__x = __exponential_tail(__g, __s, __p.__lambda_);
+			}
+			return result_type(__x * __p.__sigma_);
+		}
+
+		// Marsaglia's tail method, an exponential proposal from s, with
+		// Robert's rate lambda, 1995, which accepts at least 86% of
+		// proposals for s >= 0.8, and more the further out s is. both
+		// draws come off the exponential ziggurat, so there is no log.
+		template <class _RealType>
+		template<class _URNG>
+		double
+		gaussian_tail_distribution<_RealType>::__exponential_tail(_URNG& __g, double __s, double __lambda)
+		{
+			for(;;){
+				double __x = __s + __ziggurat_exponential::sample(__g) / __lambda;
+				double __d = __x - __lambda;
+				if(__ziggurat_exponential::sample(__g) >= __d * __d / 2){
+					return __x;
+				}
+			}
+		}
+
+		// the strips' edges solve erfc(x / sqrt(2)) = erfc(s / sqrt(2)) (1 - i / n).
+		// erfc is convex and decreasing, so Newton's method started from
+		// the edge before climbs to the root without overshooting.
+		template <class _RealType>
+		void
+		gaussian_tail_distribution<_RealType>::param_type::__tabulate()
+		{
+			const size_t __n = __table_size;
+			const double __rt2 = 1.4142135623730951;
+			const double __c = erfc(__s_ / __rt2);
+			// the density is not monotone below 0, and the ratios lose
+			// their precision once the tail mass is subnormal
+			if(!(__s_ >= 0) || !(__c >= std::numeric_limits<double>::min())){
+				return;
+			}
+			__x_.resize(__n);
+			__r_.resize(__n);
+			__x_[0] = __s_;
+			// sqrt(2 / pi)
+			const double __k = 0.79788456080286536;
+			for(size_t __i = 1; __i < __n; __i++){
+				const double __target = __c * (1 - double(__i) / __n);
+				double __x = __x_[__i - 1];
+				for(int __j = 0; __j < 100; __j++){
+					double __dx = (erfc(__x / __rt2) - __target) / (__k * exp(-__x * __x / 2));
+					if(!(__dx > __x * 1e-16)){
+						break;
+					}
+					__x += __dx;
+				}
+				__x_[__i] = __x;
 			}
+			for(size_t __i = 0; __i + 1 < __n; __i++){
+				__r_[__i] = exp((__x_[__i] - __x_[__i + 1]) * (__x_[__i] + __x_[__i + 1]) / 2);
+			}
+			__r_[__n - 1] = 0;
+			const double __xl = __x_[__n - 1];
+			__tail_lambda_ = (__xl + sqrt(__xl * __xl + 4)) / 2;
 		}
 
 		template <class _CharT, class _Traits, class _RT>
@@ -2785,17 +6880,11 @@ namespace x
 		std::vector<_RealType>
 		bivariate_normal_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::uniform_real_distribution<result_type> du(0, 1);
-			result_type u1, u2, r;
-			do{
-				u1 = -1 + 2 * du(__g);
-				u2 = -1 + 2 * du(__g);
-				r = u1 * u1 + u2 * u2;
-			}while(r > 1.0 || r == 0);
-			result_type s = sqrt(-2. * log(r) / r);
+			result_type z1 = __ziggurat_normal::sample(__g);
+			result_type z2 = __ziggurat_normal::sample(__g);
 			result_type rho = __p.rho();
-			result_type x = __p.sigmax() * u1 * s;
-			result_type y = __p.sigmay() * (rho * u1 + sqrt(1 - rho * rho) * u2) * s;
+			result_type x = __p.sigmax() * z1;
+			result_type y = __p.sigmay() * (rho * z1 + sqrt(1 - rho * rho) * z2);
 			std::vector<_RealType> out{x, y};
 			return out;
 		}
@@ -2862,21 +6951,63 @@ namespace x
 			{
 				result_type __alpha_;
 				result_type __beta_;
+				// the method depends only on beta: a power of a gamma
+				// variate for beta < 1 or beta > 4, the laplace and
+				// normal distributions themselves at 1 and 2, and
+				// rejection from a laplace or normal envelope of scale
+				// B = (1 / beta)^(1 / beta) in between
+				enum {__gamma, __laplace, __laplace_rejection, __normal, __normal_rejection} __method_;
+				double __inv_beta_;
+				double __B_;
+				// the log of the acceptance ratio, less |x|^beta, is
+				// c0 + |x| / B for the laplace envelope and
+				// c0 + c1 x^2 for the normal one
+				double __c0_;
+				double __c1_;
+				typename gamma_distribution<double>::param_type __gp_;
 			public:
 				typedef exponential_power_distribution distribution_type;
 				explicit param_type(result_type __alpha = 1, result_type __beta = 1)
-					: __alpha_(__alpha), __beta_(__beta) {}
+					: __alpha_(__alpha), __beta_(__beta)
+				{
+					__inv_beta_ = 1. / __beta;
+					__B_ = pow(__inv_beta_, __inv_beta_);
+					__c0_ = 0;
+					__c1_ = 0;
+					if(__beta < 1 || __beta > 4){
+						__method_ = __gamma;
+						__gp_ = typename gamma_distribution<double>::param_type(__inv_beta_, 1.);
+					}else if(__beta == 1){
+						__method_ = __laplace;
+					}else if(__beta < 2){
+						__method_ = __laplace_rejection;
+						__c0_ = __inv_beta_ - 1;
+					}else if(__beta == 2){
+						__method_ = __normal;
+					}else{
+						__method_ = __normal_rejection;
+						__c0_ = __inv_beta_ - 0.5;
+						__c1_ = 1 / (2 * __B_ * __B_);
+					}
+				}
 				result_type alpha() const {return __alpha_;}
 				result_type beta() const {return __beta_;}
 				friend bool operator==(const param_type& __x, const param_type& __y)
 				{return __x.__alpha_ == __y.__alpha_ && __x.__beta_ == __y.__beta_;}
 				friend bool operator!=(const param_type& __x, const param_type& __y)
 				{return !(__x == __y);}
+
+				friend class exponential_power_distribution;
 			};
 
 		private:
 			param_type __p_;
 
+			// the magnitude of one accepted draw for beta = 1, 1 < beta < 2
+			// and beta > 4 or < 1, before scaling by alpha
+			template<class _URNG>
+			static double __magnitude(_URNG& __g, const param_type& __p);
+
 		public:
 			// constructors and reset functions
 			explicit exponential_power_distribution(result_type __alpha = 1, result_type __beta = 1)
@@ -2891,6 +7022,17 @@ namespace x
 			{return (*this)(__g, __p_);}
 			template<class _URNG> result_type operator()(_URNG& __g, const param_type& __p);
 
+			// fills [f, l) a block at a time: the rejection methods
+			// make a block of proposals, test them all in one loop with
+			// no calls to the engine, and compact the accepted ones
+			// into the output. the signs come 64 to an engine word. the
+			// draws are not those of repeated calls to operator().
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g)
+			{generate(__f, __l, __g, __p_);}
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p);
+
 			// property functions
 			result_type alpha() const {return __p_.alpha();}
 			result_type beta() const {return __p_.beta();}
@@ -2928,53 +7070,138 @@ namespace x
 		_RealType
 		exponential_power_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			result_type a = __p.alpha();
-			result_type b = __p.beta();
+			switch(__p.__method_){
+			case param_type::__normal:
+				return result_type(__p.__alpha_ * 0.70710678118654752 * __ziggurat_normal::sample(__g));
+			case param_type::__normal_rejection:
+				for(;;){
+					double __x = __p.__B_ * __ziggurat_normal::sample(__g);
+					double __h = __p.__c0_ + __p.__c1_ * __x * __x - pow(fabs(__x), __p.__beta_);
+					// log(u) <= h, with -log(u) exponential
+					if(-__h <= __ziggurat_exponential::sample(__g)){
+						return result_type(__p.__alpha_ * __x);
+					}
+				}
+			default:
+				{
+					double __z = __p.__alpha_ * __magnitude(__g, __p);
+					return result_type(__random_bits64(__g) >> 63 ? __z : -__z);
+				}
+			}
+		}
 
-			if(b < 1 || b > 4){
-				std::uniform_real_distribution<result_type> du(0, 1);
-				gamma_distribution<result_type> g(1. / b, 1.);
-				result_type u = du(__g);
-				result_type v = g(__g);
-				result_type z = a * pow(v, 1 / b);
-				if(u > 0.5){
-					return z;
-				}else{
-					return -z;
-				}
-			}else if(b == 1){
-				laplace_distribution<result_type> l(0, a);
-				return l(__g);
-			}else if(b < 2){
-				double x, h, u, B = pow(1 / b, 1 / b);
-				laplace_distribution<result_type> l(0, B);
-				std::uniform_real_distribution<result_type> du(0, 1);
-				do{
-					x = l(__g);
-					do{
-						u = du(__g);
-					}while(u == 0);
-					h = -pow(fabs(x), b) + fabs(x) / B - 1 + (1 / b);
-				}while(log(u) > h);
-				return a * x;
-			}else if(b == 2){
-				normal_distribution<result_type> g(0., a / sqrt(2.));
-				return g(__g);
-			}else{
-				double x, h, u, B = pow(1 / b, 1 / b);
-				normal_distribution<result_type> g(0., B);
-				std::uniform_real_distribution<result_type> du(0, 1);
-				do{
-					x = g(__g);
-					do{
-						u = du(__g);
-					}while(u == 0);
-					h = -pow(fabs(x), b) + (x * x) / (2 * B * B) * (1 / b) - 0.5;
-				}while(log(u) > h);
-				return a * x;
+		template <class _RealType>
+		template<class _URNG>
+		double
+		exponential_power_distribution<_RealType>::__magnitude(_URNG& __g, const param_type& __p)
+		{
+			if(__p.__method_ == param_type::__gamma){
+				gamma_distribution<double> __gd;
+				return pow(__gd(__g, __p.__gp_), __p.__inv_beta_);
+			}
+			if(__p.__method_ == param_type::__laplace){
+				return __ziggurat_exponential::sample(__g);
+			}
+			for(;;){
+				double __e = __ziggurat_exponential::sample(__g);
+				double __x = __p.__B_ * __e;
+				double __h = __p.__c0_ + __e - pow(__x, __p.__beta_);
+				if(-__h <= __ziggurat_exponential::sample(__g)){
+					return __x;
+				}
+			}
+		}
+
+		template <class _RealType>
+		template<class _ForwardIterator, class _URNG>
+		void
+		exponential_power_distribution<_RealType>::generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p)
+		{
+			const double __a = __p.__alpha_;
+			if(__p.__method_ == param_type::__normal){
+				const double __s = __a * 0.70710678118654752;
+				for(; __f != __l; ++__f){
+					*__f = result_type(__s * __ziggurat_normal::sample(__g));
+				}
+				return;
+			}
+			const int __bs = 256;
+			double __x[__bs];
+			double __t[__bs];
+			const bool __rejection = __p.__method_ == param_type::__laplace_rejection
+				|| __p.__method_ == param_type::__normal_rejection;
+			const bool __sign = __p.__method_ != param_type::__normal_rejection;
+			const double __b = __p.__beta_, __B = __p.__B_, __c0 = __p.__c0_, __c1 = __p.__c1_;
+			gamma_distribution<double> __gd;
+			uint64_t __bits = 0;
+			int __nbits = 0;
+			while(__f != __l){
+				// no more proposals than there are places left, so that
+				// everything accepted can be written out
+				int __m = 0;
+				for(_ForwardIterator __i = __f; __i != __l && __m < __bs; ++__i){
+					__m++;
+				}
+				switch(__p.__method_){
+				case param_type::__gamma:
+					for(int __i = 0; __i < __m; __i++){
+						__x[__i] = __gd(__g, __p.__gp_);
+					}
+					for(int __i = 0; __i < __m; __i++){
+						__x[__i] = pow(__x[__i], __p.__inv_beta_);
+					}
+					break;
+				case param_type::__laplace:
+					for(int __i = 0; __i < __m; __i++){
+						__x[__i] = __ziggurat_exponential::sample(__g);
+					}
+					break;
+				case param_type::__laplace_rejection:
+					for(int __i = 0; __i < __m; __i++){
+						__x[__i] = __ziggurat_exponential::sample(__g);
+						__t[__i] = __ziggurat_exponential::sample(__g);
+					}
+					for(int __i = 0; __i < __m; __i++){
+						double __e = __x[__i];
+						__x[__i] = __B * __e;
+						__t[__i] += __c0 + __e - pow(__x[__i], __b);
+					}
+					break;
+				default:
+					for(int __i = 0; __i < __m; __i++){
+						__x[__i] = __B * __ziggurat_normal::sample(__g);
+						__t[__i] = __ziggurat_exponential::sample(__g);
+					}
+					for(int __i = 0; __i < __m; __i++){
+						__t[__i] += __c0 + __c1 * __x[__i] * __x[__i] - pow(fabs(__x[__i]), __b);
+					}
+					break;
+				}
+				int __k = __m;
+				if(__rejection){
+					__k = 0;
+					for(int __i = 0; __i < __m; __i++){
+						__x[__k] = __x[__i];
+						__k += __t[__i] >= 0;
+					}
+				}
+				for(int __i = 0; __i < __k; __i++, ++__f){
+					double __z = __a * __x[__i];
+					if(__sign){
+						if(__nbits == 0){
+							__bits = __random_bits64(__g);
+							__nbits = 64;
+						}
+						__z = __bits & 1 ? __z : -__z;
+						__bits >>= 1;
+						__nbits--;
+					}
+					*__f = result_type(__z);
+				}
 			}
 		}
 
+
 		template <class _CharT, class _Traits, class _RT>
 		std::basic_ostream<_CharT, _Traits>&
 		operator<<(std::basic_ostream<_CharT, _Traits>& __os,
@@ -3100,11 +7327,7 @@ namespace x
 		_RealType
 		rayleigh_tail_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::uniform_real_distribution<result_type> du(0, 1);
-			result_type u, a = __p.a(), sigma = __p.sigma();
-			do{
-				u = du(__g);
-			}while(u == 0);
+			result_type u = __open_uniform(__g), a = __p.a(), sigma = __p.sigma();
 			return sqrt(a * a - 2. * sigma * sigma * log(u));
 		}
 
@@ -3233,11 +7456,7 @@ namespace x
 		_RealType
 		logistic_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::uniform_real_distribution<result_type> du(0, 1);
-			result_type u;
-			do{
-				u = du(__g);
-			}while(u == 0 || u == 1);
+			result_type u = __open_uniform(__g);
 			return __p.mu() + __p.s() * log(u / (1 - u));
 		}
 
@@ -3371,11 +7590,7 @@ namespace x
 			result_type a = __p.a();
 			result_type b = __p.b();
 
-			std::uniform_real_distribution<result_type> du(0, 1);
-			result_type u;
-			do{
-				u = du(__g);
-			}while(u == 0);
+			result_type u = __open_uniform(__g);
 			return a / pow(u, 1. / b);
 		}
 
@@ -3500,14 +7715,9 @@ namespace x
 		_RealType
 		gumbel_distribution<_RealType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			std::uniform_real_distribution<result_type> du(0, 1);
 			result_type m = __p.mu();
 			result_type b = __p.beta();
-			result_type u;
-			do{
-				u = du(__g);
-			}while(u == 0);
-			
+			result_type u = __open_uniform(__g);
 			return m - b * log(-log(u));
 		}
 
@@ -3569,10 +7779,17 @@ namespace x
 			class param_type
 			{
 				double __p_;
+				// log(1 - p), and f(1) = -p / log(1 - p), the first
+				// term of the pmf, which the search starts from
+				double __r_;
+				double __f1_;
+				// search for small p, where the mean is close to 1
+				bool __ls_;
 			public:
 				typedef logarithmic_series_distribution distribution_type;
 
-				explicit param_type(double __p = 0.5) : __p_(__p) {}
+				explicit param_type(double __p = 0.5)
+					: __p_(__p), __r_(log1p(-__p)), __f1_(-__p / __r_), __ls_(__p < 0.95) {}
 
 				double p() const {return __p_;}
 
@@ -3580,11 +7797,18 @@ namespace x
 				{return __x.__p_ == __y.__p_;}
 				friend bool operator!=(const param_type& __x, const param_type& __y)
 				{return !(__x == __y);}
+
+				friend class logarithmic_series_distribution;
 			};
 
 		private:
 			param_type __p_;
 
+			template<class _URNG>
+			static long __search(_URNG& __g, double __p, double __f1);
+			template<class _URNG>
+			static long __kemp(_URNG& __g, double __p, double __r);
+
 		public:
 			// constructors and reset functions
 			explicit logarithmic_series_distribution(double __p = 0.5)
@@ -3598,6 +7822,12 @@ namespace x
 			{return (*this)(__g, __p_);}
 			template<class _URNG> result_type operator()(_URNG& __g, const param_type& __p);
 
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g)
+			{generate(__f, __l, __g, __p_);}
+			template<class _ForwardIterator, class _URNG>
+			void generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p);
+
 			// property functions
 			double p() const {return __p_.p();}
 
@@ -3636,17 +7866,81 @@ namespace x
 		_IntType
 		logarithmic_series_distribution<_IntType>::operator()(_URNG& __g, const param_type& __p)
 		{
-			// http://www.nrbook.com/devroye/Devroye_files/chapter_ten.pdf
-			// could implement the speed up
-			std::uniform_real_distribution<double> du(0, 1);
-			double u, v;
-			do{
-				u = du(__g);
-			}while(u == 0);
-			do{
-				v = du(__g);
-			}while(v == 0);
-			return 1 + (log(v) / log(1 - pow(1. - __p.p(), u)));
+			if(__p.__ls_){
+				return result_type(__search(__g, __p.__p_, __p.__f1_));
+			}
+			return result_type(__kemp(__g, __p.__p_, __p.__r_));
+		}
+
+		// Kemp's LS, 1981: sequential search up the pmf, using
+		// f(x + 1) = f(x) p x / (x + 1). the expected number of steps is
+		// the mean, which is under 6.4 for p < 0.95.
+		template <class _IntType>
+		template<class _URNG>
+		long
+		logarithmic_series_distribution<_IntType>::__search(_URNG& __g, double __p, double __f1)
+		{
+			for(;;){
+				double __u = __open_uniform(__g);
+				double __f = __f1;
+				long __x = 1;
+				// if rounding leaves u above what is left of the pmf,
+				// f underflows and we start again
+				while(__u > __f && __f > 0){
+					__u -= __f;
+					__f *= __p * __x / (__x + 1);
+					__x++;
+				}
+				if(__u <= __f){
+					return __x;
+				}
+			}
+		}
+
+		// Kemp's LK, 1981, see Devroye, 1986, X.5. with probability 1 - p
+		// the result is 1 after a single uniform, and most of the rest
+		// are settled as 1 or 2 without a log
+		template <class _IntType>
+		template<class _URNG>
+		long
+		logarithmic_series_distribution<_IntType>::__kemp(_URNG& __g, double __p, double __r)
+		{
+			for(;;){
+				double __v = __open_uniform(__g);
+				if(__v >= __p){
+					return 1;
+				}
+				double __q = -expm1(__r * __open_uniform(__g));
+				if(__v <= __q * __q){
+					long __x = (long)floor(1 + log(__v) / log(__q));
+					if(__x < 1){
+						continue;
+					}
+					return __x;
+				}
+				return __v >= __q ? 1 : 2;
+			}
+		}
+
+		// same draws as repeated calls to operator(), with the choice of
+		// method made once for the whole range
+		template <class _IntType>
+		template<class _ForwardIterator, class _URNG>
+		void
+		logarithmic_series_distribution<_IntType>::generate(_ForwardIterator __f, _ForwardIterator __l, _URNG& __g, const param_type& __p)
+		{
+			const double __pp = __p.__p_;
+			if(__p.__ls_){
+				const double __f1 = __p.__f1_;
+				for(; __f != __l; ++__f){
+					*__f = result_type(__search(__g, __pp, __f1));
+				}
+			}else{
+				const double __r = __p.__r_;
+				for(; __f != __l; ++__f){
+					*__f = result_type(__kemp(__g, __pp, __r));
+				}
+			}
 		}
 
 		template <class _CharT, class _Traits, class _IntType>
@@ -3678,21 +7972,21 @@ namespace x
 		}
 
 		// params
-		class uniform_int_distribution_param_type : public std::uniform_int_distribution<long>::param_type
+		class uniform_int_distribution_param_type : public uniform_int_distribution<long>::param_type
 		{
 		public:
-			uniform_int_distribution_param_type(void) : std::uniform_int_distribution<long>::param_type() {}
-			uniform_int_distribution_param_type(long p1, long p2) : std::uniform_int_distribution<long>::param_type(p1, p2) {}
+			uniform_int_distribution_param_type(void) : uniform_int_distribution<long>::param_type() {}
+			uniform_int_distribution_param_type(long p1, long p2) : uniform_int_distribution<long>::param_type(p1, p2) {}
 			long param1(void){return a();}
 			long param2(void){return b();}
             std::vector<const std::type_info*> paramtypes = {&typeid(param1()), &typeid(param2())};
 		};
 		
-		class uniform_real_distribution_param_type : public std::uniform_real_distribution<double>::param_type
+		class uniform_real_distribution_param_type : public uniform_real_distribution<double>::param_type
 		{
 		public:
-			uniform_real_distribution_param_type(void) : std::uniform_real_distribution<double>::param_type() {}
-			uniform_real_distribution_param_type(double p1, double p2) : std::uniform_real_distribution<double>::param_type(p1, p2) {}
+			uniform_real_distribution_param_type(void) : uniform_real_distribution<double>::param_type() {}
+			uniform_real_distribution_param_type(double p1, double p2) : uniform_real_distribution<double>::param_type(p1, p2) {}
 			double param1(void){return a();}
 			double param2(void){return b();}
             std::vector<const std::type_info*> paramtypes = {&typeid(param1()), &typeid(param2())};
@@ -49,6 +49,15 @@ void def_rng_delegate_uint32_callback(xobj_uint32 *x, size_t n)
 		*(x->n) = n;	
 	}
 	for(size_t i = 0; i < n; i++){
-		(*(x->buf))[i] = rng_pcg32_generate((x_rng *)x);
+		(*(x->buf))[i] = (uint32_t)rng_generate((x_rng *)x);
 	}
 }
+
+void def_rng_delegate_uint64_callback(xobj_uint64 *x, size_t n)
+{
+	if(!(x->n) || !(x->buf) || *(x->n) < n){
+		*(x->buf) = (uint64_t *)realloc(*(x->buf), n * sizeof(uint64_t));
+		*(x->n) = n;	
+	}
+	rng_generate_n((x_rng *)x, *(x->buf), n);
+}
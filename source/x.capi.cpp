@@ -21,6 +21,8 @@ SOFTWARE.
 */
 
 #include <random>
+#include <thread>
+#include <vector>
 #include "pcg_random.hpp"
 #include "x.random.hpp"
 #include "x.proxy.hpp"
@@ -74,12 +76,10 @@ extern void random_device_delegate_callback(x_random_device *context, size_t n);
 
 template<> void x::proxy::random_device_delegate<x::proxy::delegate<uint32_t, uint32_t, &(get_u32), &(set_u32)> >::callback(x::proxy::delegate<uint32_t, uint32_t, &(get_u32), &(set_u32)>* x, unsigned long i)
 {
-	x_random_device *o = (x_random_device *)x->context();
-	o->n = x->buffer_len_address();
-	o->buf = x->buffer_address();
-	o->callback(o, i);
-	o->n = 0;
-	o->buf = NULL;
+	x_random_device ctx = *((x_random_device *)x->context());
+	ctx.n = x->buffer_len_address();
+	ctx.buf = x->buffer_address();
+	ctx.callback(&ctx, i);
 }
 
 x_seed_seq_from *seed_seq_from_new_with_callback(x_random_device *random_device, xobj_uint32_callback random_device_delegate_callback)
@@ -111,9 +111,14 @@ void seed_seq_from_setcontext(x_seed_seq_from *ssf, void *context)
 void seed_seq_from_generate(x_seed_seq_from *_ssf, uint32_t *start, uint32_t *end)
 {
 	x::proxy::seed_seq_from<x::proxy::random_device_delegate<x::proxy::delegate<uint_least32_t, uint32_t, get_u32, set_u32>>> *ssf = reinterpret_cast<x::proxy::seed_seq_from<x::proxy::random_device_delegate<x::proxy::delegate<uint_least32_t, uint32_t, get_u32, set_u32>>>*>(_ssf->myobj);
-	ssf->buffer(start);
-	ssf->buffer_len(end - start);
-	ssf->generate(start, end);
+	// the random device hands out one word per call into the start of
+	// the buffer, so point the buffer at each word in turn; pointing
+	// it at start once would leave every word equal to the last one
+	for(uint32_t *p = start; p < end; p++){
+		ssf->buffer(p);
+		ssf->buffer_len(1);
+		ssf->generate(p, p + 1);
+	}
 }
 
 //////////////////////////////////////////////////
@@ -126,12 +131,10 @@ extern void seed_seq_from_delegate_callback(x_seed_seq_from *context, size_t n);
 
 template <> void x::proxy::seed_seq_from_delegate<seed_seq_from_delegate_base, std::random_device>::callback(seed_seq_from_delegate_base *x, size_t n)
 {
-	x_seed_seq_from *o = (x_seed_seq_from *)x->context();
-	o->n = x->buffer_len_address();
-	o->buf = x->buffer_address();
-	o->callback(o, n);
-	o->n = 0;
-	o->buf = NULL;
+	x_seed_seq_from ctx = *((x_seed_seq_from *)x->context());
+	ctx.n = x->buffer_len_address();
+	ctx.buf = x->buffer_address();
+	ctx.callback(&ctx, n);
 }
 
 x_seed_seq_from_delegate *seed_seq_from_delegate_new_with_callback(x_seed_seq_from *seed_seq_from, xobj_uint32_callback seed_seq_from_delegate_callback)
@@ -170,34 +173,103 @@ void seed_seq_from_delegate_setcontext(x_seed_seq_from_delegate *ssfd, void *con
 // rngs
 //////////////////////////////////////////////////
 
-x_rng *rng_pcg32_new(x_seed_seq_from_delegate *ssfd)
-{
-	x_rng *x = (x_rng *)calloc(1, sizeof(x_rng));
-	x->obj.myobj = new pcg32(*reinterpret_cast<x::proxy::seed_seq_from_delegate<seed_seq_from_delegate_base, std::random_device>*>(ssfd->myobj));
-	x->min = pcg32::min();
-	x->max = pcg32::max();
-	return x;
-}
-
-void rng_pcg32_delete(x_rng *x)
-{
-	delete reinterpret_cast<pcg32*>(x->obj.myobj);
-	free(x);
-}
+#define RNG_DEFN(rng, rng_ret_type, rng_type_tag)			\
+	x_rng *rng_##rng##_new(x_seed_seq_from_delegate *ssfd)		\
+	{								\
+		x_rng *x = (x_rng *)calloc(1, sizeof(x_rng));		\
+		x->obj.myobj = new x::random::rng(*reinterpret_cast<x::proxy::seed_seq_from_delegate<seed_seq_from_delegate_base, std::random_device>*>(ssfd->myobj)); \
+		x->min = x::random::rng::min();				\
+		x->max = x::random::rng::max();				\
+		x->type = rng_type_tag;					\
+		return x;						\
+	}								\
+									\
+	void rng_##rng##_delete(x_rng *x)				\
+	{								\
+		delete reinterpret_cast<x::random::rng*>(x->obj.myobj);	\
+		free(x->block);						\
+		free(x);						\
+	}								\
+									\
+	rng_ret_type rng_##rng##_min(void)				\
+	{								\
+		return x::random::rng::min();				\
+	}								\
+									\
+	rng_ret_type rng_##rng##_max(void)				\
+	{								\
+		return x::random::rng::max();				\
+	}								\
+									\
+	rng_ret_type rng_##rng##_generate(x_rng *r)			\
+	{								\
+		return reinterpret_cast<x::random::rng*>(r->obj.myobj)->operator()(); \
+	}
 
-uint32_t rng_pcg32_min(void)
+RNG_DEFN(pcg32, uint32_t, X_RNG_PCG32)
+RNG_DEFN(pcg64, uint64_t, X_RNG_PCG64)
+RNG_DEFN(minstd_rand0, uint32_t, X_RNG_MINSTD_RAND0)
+RNG_DEFN(minstd_rand, uint32_t, X_RNG_MINSTD_RAND)
+RNG_DEFN(mt19937, uint32_t, X_RNG_MT19937)
+RNG_DEFN(mt19937_64, uint64_t, X_RNG_MT19937_64)
+RNG_DEFN(ranlux24, uint32_t, X_RNG_RANLUX24)
+RNG_DEFN(ranlux48, uint64_t, X_RNG_RANLUX48)
+RNG_DEFN(knuth_b, uint32_t, X_RNG_KNUTH_B)
+RNG_DEFN(philox4x32, uint32_t, X_RNG_PHILOX4X32)
+RNG_DEFN(threefry4x64, uint64_t, X_RNG_THREEFRY4X64)
+RNG_DEFN(xoshiro256pp, uint64_t, X_RNG_XOSHIRO256PP)
+
+void rng_delete(x_rng *r)
 {
-	return pcg32::min();
+	switch(r->type){
+	case X_RNG_PCG32: rng_pcg32_delete(r); break;
+	case X_RNG_PCG64: rng_pcg64_delete(r); break;
+	case X_RNG_MINSTD_RAND0: rng_minstd_rand0_delete(r); break;
+	case X_RNG_MINSTD_RAND: rng_minstd_rand_delete(r); break;
+	case X_RNG_MT19937: rng_mt19937_delete(r); break;
+	case X_RNG_MT19937_64: rng_mt19937_64_delete(r); break;
+	case X_RNG_RANLUX24: rng_ranlux24_delete(r); break;
+	case X_RNG_RANLUX48: rng_ranlux48_delete(r); break;
+	case X_RNG_KNUTH_B: rng_knuth_b_delete(r); break;
+	case X_RNG_PHILOX4X32: rng_philox4x32_delete(r); break;
+	case X_RNG_THREEFRY4X64: rng_threefry4x64_delete(r); break;
+	case X_RNG_XOSHIRO256PP: rng_xoshiro256pp_delete(r); break;
+	default: free(r->block); free(r); break;
+	}
 }
 
-uint32_t rng_pcg32_max(void)
+uint64_t rng_generate(x_rng *r)
 {
-	return pcg32::max();
+	switch(r->type){
+	case X_RNG_PCG32: return rng_pcg32_generate(r);
+	case X_RNG_PCG64: return rng_pcg64_generate(r);
+	case X_RNG_MINSTD_RAND0: return rng_minstd_rand0_generate(r);
+	case X_RNG_MINSTD_RAND: return rng_minstd_rand_generate(r);
+	case X_RNG_MT19937: return rng_mt19937_generate(r);
+	case X_RNG_MT19937_64: return rng_mt19937_64_generate(r);
+	case X_RNG_RANLUX24: return rng_ranlux24_generate(r);
+	case X_RNG_RANLUX48: return rng_ranlux48_generate(r);
+	case X_RNG_KNUTH_B: return rng_knuth_b_generate(r);
+	case X_RNG_PHILOX4X32: return rng_philox4x32_generate(r);
+	case X_RNG_THREEFRY4X64: return rng_threefry4x64_generate(r);
+	case X_RNG_XOSHIRO256PP: return rng_xoshiro256pp_generate(r);
+	default: return 0;
+	}
 }
 
-uint32_t rng_pcg32_generate(x_rng *r)
+uint64_t *rng_generate_n(x_rng *r, uint64_t *res, long count)
 {
-	return reinterpret_cast<pcg32*>(r->obj.myobj)->operator()();
+	switch(r->type){
+	case X_RNG_XOSHIRO256PP:
+		reinterpret_cast<x::random::xoshiro256pp*>(r->obj.myobj)->generate(res, res + count);
+		break;
+	default:
+		for(long i = 0; i < count; i++){
+			res[i] = rng_generate(r);
+		}
+		break;
+	}
+	return res;
 }
 
 uint64_t rng_min(x_rng *r)
@@ -216,6 +288,134 @@ uint64_t rng_max(x_rng *r)
 	return 0;
 }
 
+// drops the words buffered for the delegate, keeping the memory
+static void rng_flush(x_rng *r)
+{
+	r->block_pos = 0;
+	r->block_avail = 0;
+}
+
+void rng_setblocklen(x_rng *r, size_t n)
+{
+	if(r){
+		r->block_len = n;
+		rng_flush(r);
+	}
+}
+
+size_t rng_getblocklen(x_rng *r)
+{
+	if(r && r->block_len > 1){
+		return r->block_len;
+	}
+	return 1;
+}
+
+void rng_setuniformbits(x_rng *r, int bits)
+{
+	if(r){
+		r->uniform_bits = bits < 0 ? 0 : bits > 53 ? 53 : bits;
+	}
+}
+
+int rng_getuniformbits(x_rng *r)
+{
+	if(r && r->uniform_bits > 0){
+		return r->uniform_bits;
+	}
+	return X_RANDOM_UNIFORM_BITS;
+}
+
+#define RNG_ADVANCE_CASE(rng, rng_type_tag, engine_stmt)		\
+	case rng_type_tag: reinterpret_cast<x::random::rng*>(r->obj.myobj)->engine_stmt; break
+
+void rng_advance(x_rng *r, uint64_t delta)
+{
+	if(!r){
+		return;
+	}
+	rng_flush(r);
+	switch(r->type){
+		RNG_ADVANCE_CASE(pcg32, X_RNG_PCG32, advance(delta));
+		RNG_ADVANCE_CASE(pcg64, X_RNG_PCG64, advance(delta));
+		RNG_ADVANCE_CASE(minstd_rand0, X_RNG_MINSTD_RAND0, advance(delta));
+		RNG_ADVANCE_CASE(minstd_rand, X_RNG_MINSTD_RAND, advance(delta));
+		RNG_ADVANCE_CASE(mt19937, X_RNG_MT19937, advance(delta));
+		RNG_ADVANCE_CASE(mt19937_64, X_RNG_MT19937_64, advance(delta));
+		RNG_ADVANCE_CASE(ranlux24, X_RNG_RANLUX24, discard(delta));
+		RNG_ADVANCE_CASE(ranlux48, X_RNG_RANLUX48, discard(delta));
+		RNG_ADVANCE_CASE(knuth_b, X_RNG_KNUTH_B, discard(delta));
+		RNG_ADVANCE_CASE(philox4x32, X_RNG_PHILOX4X32, advance(delta));
+		RNG_ADVANCE_CASE(threefry4x64, X_RNG_THREEFRY4X64, advance(delta));
+		RNG_ADVANCE_CASE(xoshiro256pp, X_RNG_XOSHIRO256PP, discard(delta));
+	default: break;
+	}
+}
+
+x_rng *rng_seek(x_rng *r, uint64_t stream, uint64_t index)
+{
+	if(!r){
+		return NULL;
+	}
+	rng_flush(r);
+	switch(r->type){
+		RNG_ADVANCE_CASE(philox4x32, X_RNG_PHILOX4X32, seek(stream, index));
+		RNG_ADVANCE_CASE(threefry4x64, X_RNG_THREEFRY4X64, seek(stream, index));
+	default: return NULL;
+	}
+	return r;
+}
+
+#define RNG_SPLIT_CASE(rng, rng_type_tag)				\
+	case rng_type_tag:						\
+	{								\
+		x::random::rng *e = reinterpret_cast<x::random::rng*>(r->obj.myobj); \
+		for(long i = 0; i < k; i++){				\
+			children[i] = (x_rng *)malloc(sizeof(x_rng));	\
+			*children[i] = *r;				\
+			children[i]->obj.myobj = new x::random::rng(*e); \
+			children[i]->block = NULL;			\
+			children[i]->block_size = 0;			\
+			rng_flush(children[i]);				\
+			e->jump();					\
+		}							\
+		return children;					\
+	}
+
+x_rng **rng_split(x_rng *r, long k, x_rng **children)
+{
+	if(!r || !children || k < 0){
+		return NULL;
+	}
+	if((r->type == X_RNG_MINSTD_RAND0 || r->type == X_RNG_MINSTD_RAND) && k > X_RNG_MINSTD_MAX_SPLIT){
+		return NULL;
+	}
+	if(r->type == X_RNG_PCG32 && k > X_RNG_PCG32_MAX_SPLIT){
+		return NULL;
+	}
+	rng_flush(r);
+	switch(r->type){
+		RNG_SPLIT_CASE(pcg32, X_RNG_PCG32);
+		RNG_SPLIT_CASE(pcg64, X_RNG_PCG64);
+		RNG_SPLIT_CASE(minstd_rand0, X_RNG_MINSTD_RAND0);
+		RNG_SPLIT_CASE(minstd_rand, X_RNG_MINSTD_RAND);
+		RNG_SPLIT_CASE(mt19937, X_RNG_MT19937);
+		RNG_SPLIT_CASE(mt19937_64, X_RNG_MT19937_64);
+		RNG_SPLIT_CASE(philox4x32, X_RNG_PHILOX4X32);
+		RNG_SPLIT_CASE(threefry4x64, X_RNG_THREEFRY4X64);
+		RNG_SPLIT_CASE(xoshiro256pp, X_RNG_XOSHIRO256PP);
+	default: return NULL;
+	}
+}
+
+xobj_uint32_callback rng_default_callback(x_rng *r)
+{
+	if(r && r->max > 0xFFFFFFFF){
+		return (xobj_uint32_callback)def_rng_delegate_uint64_callback;
+	}
+	return def_rng_delegate_uint32_callback;
+}
+
 //////////////////////////////////////////////////
 // Rng_delegate
 //////////////////////////////////////////////////
@@ -263,98 +463,203 @@ template<> void x::proxy::rng_delegate<rng_delegate_uint32, uint32_t, 1, 0xFFFFF
 
 template<> void x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 0, 0xFFFFFFFFFFFF>::callback(rng_delegate_uint64 *o, size_t n)
 {
-
+	xobj_uint64 *x = (xobj_uint64 *)(o->context());
+	x->callback(x, n);
 }
 
 template<> void x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 1, 0xFFFFFFFFFFFF>::callback(rng_delegate_uint64 *o, size_t n)
 {
-
+	xobj_uint64 *x = (xobj_uint64 *)(o->context());
+	x->callback(x, n);
 }
 
 template<> void x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 0, 0xFFFFFFFFFFFFFFFF>::callback(rng_delegate_uint64 *o, size_t n)
 {
-
+	xobj_uint64 *x = (xobj_uint64 *)(o->context());
+	x->callback(x, n);
 }
 
 template<> void x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 1, 0xFFFFFFFFFFFFFFFF>::callback(rng_delegate_uint64 *o, size_t n)
 {
+	xobj_uint64 *x = (xobj_uint64 *)(o->context());
+	x->callback(x, n);
+}
 
+} // extern "C"
+
+// f is called with g, or with g wrapped in a uniform_bits_engine when
+// rng asks for a uniform resolution other than the build's. engines
+// whose words hold 53 bits or more take one word either way, so they
+// are never wrapped. a request that fits in one word takes one word,
+// and anything more takes the full 53 bits.
+template <class _URNG, class _F>
+static inline void dist_uniform_bits(x_rng *rng, _URNG &g, _F f)
+{
+	constexpr int w = x::random::__engine_bits<_URNG>();
+	if constexpr(w < 53){
+		int n = rng->uniform_bits > 0 ? rng->uniform_bits : X_RANDOM_UNIFORM_BITS;
+		if(n <= w){
+			x::random::uniform_bits_engine<w, _URNG> g1(g);
+			f(g1);
+		}else{
+			x::random::uniform_bits_engine<53, _URNG> g2(g);
+			f(g2);
+		}
+	}else{
+		f(g);
+	}
 }
 
+extern "C" {
+
 //////////////////////////////////////////////////
 // distributions
 //////////////////////////////////////////////////
-#define DIST_CALL(dist_ret_name, rng_type, min, max)	\
+// dist_stmt is evaluated with the delegate bound to rngd, e.g.
+// DIST_CALL_SWITCH(ret = d(rngd))
+// the delegate is bound to a copy of rng on the stack, so the
+// callback pointers in the shared x_rng are never written. the
+// delegate starts from the block of words left in rng by the last
+// call, and hands what it leaves back to rng.
+#define DIST_CALL(dist_stmt, rng_type, rng_obj, min, max)	\
 	{\
-		int i = 0;\
+		x_rng ctx = *rng;\
 		x::proxy::rng_delegate<rng_delegate_##rng_type, rng_type##_t, min, max> rngd;\
-		rngd.context(rng);\
-		rng_type##_t buf = 0;\
-		rngd.buffer(&buf);\
-		rngd.buffer_len(1);\
-		rng->obj.buf = rngd.buffer_address();\
-		rng->obj.n = rngd.buffer_len_address();\
-		rng->obj.callback = rng_delegate_callback;\
-		dist_ret_name = d(rngd);\
+		rngd.context(&ctx);\
+		rngd.block_len(rng_getblocklen(rng));\
+		rngd.buffer((rng_type##_t *)rng->block);\
+		rngd.buffer_len(rng->block_size);\
+		rngd.resume(rng->block_pos, rng->block_avail);\
+		ctx.rng_obj.buf = rngd.buffer_address();\
+		ctx.rng_obj.n = rngd.buffer_len_address();\
+		ctx.rng_obj.callback = (xobj_##rng_type##_callback)rng_delegate_callback;\
+		dist_uniform_bits(rng, rngd, [&](auto &rngd){dist_stmt;});\
+		rng->block = rngd.buffer();\
+		rng->block_size = rngd.buffer_len();\
+		rng->block_pos = rngd.position();\
+		rng->block_avail = rngd.available();\
 		rngd.buffer(NULL);\
 		rngd.buffer_len(0);\
-		rng->obj.buf = NULL;\
-		rng->obj.n = 0;\
 	}
 
-#define DIST_CALL_SWITCH(dist_ret_name)					\
+#define DIST_CALL_SWITCH(dist_stmt)					\
 	{								\
 		if(rng_max == 0xFFFFFF){				\
 			switch(rng_min){				\
 			case 0:						\
-				DIST_CALL(dist_ret_name, uint32, 0, 0xFFFFFF); \
+				DIST_CALL(dist_stmt, uint32, obj, 0, 0xFFFFFF); \
+				break;					\
 			case 1:						\
-				DIST_CALL(dist_ret_name, uint32, 1, 0xFFFFFF); \
+				DIST_CALL(dist_stmt, uint32, obj, 1, 0xFFFFFF); \
+				break;					\
 			}						\
 		}else if(rng_max == 0x7FFFFFFE){			\
 			switch(rng_min){				\
 			case 0:						\
-				DIST_CALL(dist_ret_name, uint32, 0, 0x7FFFFFFE); \
+				DIST_CALL(dist_stmt, uint32, obj, 0, 0x7FFFFFFE); \
 				break;					\
 			case 1:						\
-				DIST_CALL(dist_ret_name, uint32, 1, 0x7FFFFFFE); \
+				DIST_CALL(dist_stmt, uint32, obj, 1, 0x7FFFFFFE); \
 				break;					\
 			}						\
 		}else if(rng_max == 0xFFFFFFFF){			\
 			switch(rng_min){				\
 			case 0:						\
-				DIST_CALL(dist_ret_name, uint32, 0, 0xFFFFFFFF); \
+				DIST_CALL(dist_stmt, uint32, obj, 0, 0xFFFFFFFF); \
 				break;					\
 			case 1:						\
-				DIST_CALL(dist_ret_name, uint32, 1, 0xFFFFFFFF); \
+				DIST_CALL(dist_stmt, uint32, obj, 1, 0xFFFFFFFF); \
 				break;					\
 			}						\
 		}else if(rng_max == 0xFFFFFFFFFFFF){			\
 			switch(rng_min){				\
 			case 0:						\
-				{					\
-				}					\
+				DIST_CALL(dist_stmt, uint64, obj64, 0, 0xFFFFFFFFFFFF); \
 				break;					\
 			case 1:						\
-				{					\
-				}					\
+				DIST_CALL(dist_stmt, uint64, obj64, 1, 0xFFFFFFFFFFFF); \
 				break;					\
 			}						\
 		}else if(rng_max == 0xFFFFFFFFFFFFFFFF){		\
 			switch(rng_min){				\
 			case 0:						\
-				{					\
-				}					\
+				DIST_CALL(dist_stmt, uint64, obj64, 0, 0xFFFFFFFFFFFFFFFF); \
 				break;					\
 			case 1:						\
-				{					\
-				}					\
+				DIST_CALL(dist_stmt, uint64, obj64, 1, 0xFFFFFFFFFFFFFFFF); \
 				break;					\
 			}						\
 		}else{							\
 		}							\
 	}
 
+// native engines are sampled directly, so the sampler is instantiated
+// on the concrete engine type and the engine can be inlined
+#define DIST_ENGINE_CALL(dist_stmt, rng_type)				\
+	{								\
+		x::random::rng_type &rngd = *reinterpret_cast<x::random::rng_type*>(rng->obj.myobj); \
+		dist_uniform_bits(rng, rngd, [&](auto &rngd){dist_stmt;}); \
+	}
+
+#define DIST_ENGINE_SWITCH(dist_stmt)					\
+	{								\
+		switch(rng->type){					\
+		case X_RNG_PCG32:					\
+			DIST_ENGINE_CALL(dist_stmt, pcg32);		\
+			break;						\
+		case X_RNG_PCG64:					\
+			DIST_ENGINE_CALL(dist_stmt, pcg64);		\
+			break;						\
+		case X_RNG_MINSTD_RAND0:				\
+			DIST_ENGINE_CALL(dist_stmt, minstd_rand0);	\
+			break;						\
+		case X_RNG_MINSTD_RAND:					\
+			DIST_ENGINE_CALL(dist_stmt, minstd_rand);	\
+			break;						\
+		case X_RNG_MT19937:					\
+			DIST_ENGINE_CALL(dist_stmt, mt19937);		\
+			break;						\
+		case X_RNG_MT19937_64:					\
+			DIST_ENGINE_CALL(dist_stmt, mt19937_64);	\
+			break;						\
+		case X_RNG_RANLUX24:					\
+			DIST_ENGINE_CALL(dist_stmt, ranlux24);		\
+			break;						\
+		case X_RNG_RANLUX48:					\
+			DIST_ENGINE_CALL(dist_stmt, ranlux48);		\
+			break;						\
+		case X_RNG_KNUTH_B:					\
+			DIST_ENGINE_CALL(dist_stmt, knuth_b);		\
+			break;						\
+		case X_RNG_PHILOX4X32:					\
+			DIST_ENGINE_CALL(dist_stmt, philox4x32);	\
+			break;						\
+		case X_RNG_THREEFRY4X64:				\
+			DIST_ENGINE_CALL(dist_stmt, threefry4x64);	\
+			break;						\
+		case X_RNG_XOSHIRO256PP:				\
+			DIST_ENGINE_CALL(dist_stmt, xoshiro256pp);	\
+			break;						\
+		default:						\
+			break;						\
+		}							\
+	}
+
+// a NULL rng_delegate_callback means sample the engine directly;
+// the delegate is only used for user supplied callbacks and for
+// x_rngs that don't wrap one of our engines
+#define DIST_DISPATCH(dist_stmt)					\
+	{								\
+		if(!rng_delegate_callback && rng->type != X_RNG_CALLBACK){ \
+			DIST_ENGINE_SWITCH(dist_stmt);			\
+		}else{							\
+			if(!rng_delegate_callback){			\
+				rng_delegate_callback = rng_default_callback(rng); \
+			}						\
+			DIST_CALL_SWITCH(dist_stmt);			\
+		}							\
+	}
+
 #define DIST_GENERATE_WITH_CALLBACK_DEFN(dist, dist_ret_type, ...)\
 	{								\
 		using namespace x::random;				\
@@ -362,46 +667,224 @@ template<> void x::proxy::rng_delegate<rng_delegate_uint64, uint64_t, 1, 0xFFFFF
 		uint64_t rng_max = rng->max;				\
 		uint64_t buf = 0;					\
 		dist##_distribution<dist_ret_type> d(__VA_ARGS__);	\
-		dist_ret_type ret;					\
-		DIST_CALL_SWITCH(ret);			\
+		dist_ret_type ret = 0;					\
+		DIST_DISPATCH(ret = d(rngd));			\
 		return ret;						\
 	}
 
 #define DIST_GENERATE_DEFN(dist, dist_ret_type, ...)\
 	{								\
-		return dist_##dist##_generate_with_callback(rng, def_rng_delegate_uint32_callback, /*rng_min, rng_max, */__VA_ARGS__); \
+		return dist_##dist##_generate_with_callback(rng, NULL, __VA_ARGS__); \
+	}
+
+#define DIST_GENERATE_N_WITH_CALLBACK_DEFN(dist, dist_ret_type, ...)\
+	{								\
+		using namespace x::random;				\
+		uint64_t rng_min = rng->min;				\
+		uint64_t rng_max = rng->max;				\
+		dist##_distribution<dist_ret_type> d(__VA_ARGS__);	\
+		DIST_DISPATCH(x::random::generate(d, res, res + count, rngd)); \
+		return res;						\
+	}
+
+#define DIST_GENERATE_N_DEFN(dist, dist_ret_type, ...)\
+	{								\
+		return dist_##dist##_generate_n_with_callback(rng, NULL, res, count, __VA_ARGS__); \
+	}
+
+} // extern "C"
+
+// chunk c of res is drawn by a fresh copy of d from e advanced c
+// strides, and each thread takes a contiguous run of chunks, so the
+// output doesn't depend on nthreads. e ends up nchunks strides ahead.
+template <typename engine_type, typename dist_type, typename ret_type>
+static void dist_parallel_fill(x_rng *rng, engine_type &e, const dist_type &d, ret_type *res, long count, long nthreads)
+{
+	long nchunks = (count + X_DIST_PARALLEL_CHUNK - 1) / X_DIST_PARALLEL_CHUNK;
+	if(nchunks <= 0){
+		return;
+	}
+	if(nthreads <= 0){
+		nthreads = std::thread::hardware_concurrency();
+	}
+	if(nthreads <= 0){
+		nthreads = 1;
+	}
+	if(nthreads > nchunks){
+		nthreads = nchunks;
+	}
+	auto fill = [rng, &e, &d, res, count](long first, long last)
+		{
+			engine_type start = e;
+			start.jump(first);
+			for(long c = first; c < last; c++){
+				engine_type g = start;
+				dist_type dc = d;
+				long end = (c + 1) * X_DIST_PARALLEL_CHUNK;
+				if(end > count){
+					end = count;
+				}
+				dist_uniform_bits(rng, g, [&](auto &gu){x::random::generate(dc, res + c * X_DIST_PARALLEL_CHUNK, res + end, gu);});
+				if(c + 1 < last){
+					start.jump();
+				}
+			}
+		};
+	std::vector<std::thread> threads;
+	for(long t = 1; t < nthreads; t++){
+		threads.emplace_back(fill, nchunks * t / nthreads, nchunks * (t + 1) / nthreads);
+	}
+	fill(0, nchunks / nthreads);
+	for(auto &t : threads){
+		t.join();
+	}
+	e.jump(nchunks);
+}
+
+extern "C" {
+
+// engines without a cheap jump, the minstd engines, whose period
+// wraps after 128 chunks, pcg32 past X_RNG_PCG32_MAX_SPLIT chunks,
+// where its period wraps, and callback rngs take fallback_stmt
+#define DIST_PARALLEL_CALL(rng_type)					\
+	{								\
+		dist_parallel_fill(rng, *reinterpret_cast<x::random::rng_type*>(rng->obj.myobj), d, res, count, nthreads); \
+	}
+
+#define DIST_PARALLEL_SWITCH(fallback_stmt)				\
+	{								\
+		switch(rng->type){					\
+		case X_RNG_PCG32:					\
+			if((count + X_DIST_PARALLEL_CHUNK - 1) / X_DIST_PARALLEL_CHUNK > X_RNG_PCG32_MAX_SPLIT){ \
+				fallback_stmt;				\
+			}else{						\
+				DIST_PARALLEL_CALL(pcg32);		\
+			}						\
+			break;						\
+		case X_RNG_PCG64:					\
+			DIST_PARALLEL_CALL(pcg64);			\
+			break;						\
+		case X_RNG_MT19937:					\
+			DIST_PARALLEL_CALL(mt19937);			\
+			break;						\
+		case X_RNG_MT19937_64:					\
+			DIST_PARALLEL_CALL(mt19937_64);			\
+			break;						\
+		case X_RNG_PHILOX4X32:					\
+			DIST_PARALLEL_CALL(philox4x32);			\
+			break;						\
+		case X_RNG_THREEFRY4X64:				\
+			DIST_PARALLEL_CALL(threefry4x64);		\
+			break;						\
+		case X_RNG_XOSHIRO256PP:				\
+			DIST_PARALLEL_CALL(xoshiro256pp);		\
+			break;						\
+		default:						\
+			fallback_stmt;					\
+			break;						\
+		}							\
+	}
+
+#define DIST_GENERATE_PARALLEL_DEFN(dist, dist_ret_type, ...)	\
+	{								\
+		using namespace x::random;				\
+		dist##_distribution<dist_ret_type> d(__VA_ARGS__);	\
+		DIST_PARALLEL_SWITCH(dist_##dist##_generate_n(rng, res, count, __VA_ARGS__)); \
+		return res;						\
+	}
+
+// copies at most buflen values of the vector v into res
+#define DIST_COPY_VECTOR(v, res, buflen)\
+	{								\
+		long _n = buflen;					\
+		if((long)v.size() < _n){				\
+			_n = v.size();					\
+		}							\
+		for(long _i = 0; _i < _n; _i++){			\
+			res[_i] = v[_i];				\
+		}							\
 	}
 
 DIST_GENERATE_WITH_CALLBACK_DECL(uniform_int, long, long a, long b)
 DIST_GENERATE_WITH_CALLBACK_DEFN(uniform_int, long, a, b)
 DIST_GENERATE_DECL(uniform_int, long, long a, long b)
 DIST_GENERATE_DEFN(uniform_int, long, a, b)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(uniform_int, long, long a, long b)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(uniform_int, long, a, b)
+DIST_GENERATE_N_DECL(uniform_int, long, long a, long b)
+DIST_GENERATE_N_DEFN(uniform_int, long, a, b)
+DIST_GENERATE_PARALLEL_DECL(uniform_int, long, long a, long b)
+DIST_GENERATE_PARALLEL_DEFN(uniform_int, long, a, b)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(uniform_real, double, double a, double b)
 DIST_GENERATE_WITH_CALLBACK_DEFN(uniform_real, double, a, b)
 DIST_GENERATE_DECL(uniform_real, double, double a, double b)
 DIST_GENERATE_DEFN(uniform_real, double, a, b)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(uniform_real, double, double a, double b)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(uniform_real, double, a, b)
+DIST_GENERATE_N_DECL(uniform_real, double, double a, double b)
+DIST_GENERATE_N_DEFN(uniform_real, double, a, b)
+DIST_GENERATE_PARALLEL_DECL(uniform_real, double, double a, double b)
+DIST_GENERATE_PARALLEL_DEFN(uniform_real, double, a, b)
 
 
 DIST_GENERATE_WITH_CALLBACK_DECL(bernoulli, long, double p)
 DIST_GENERATE_WITH_CALLBACK_DEFN(bernoulli, long, p)
 DIST_GENERATE_DECL(bernoulli, long, double p)
 DIST_GENERATE_DEFN(bernoulli, long, p)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(bernoulli, long, double p)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(bernoulli, long, p)
+DIST_GENERATE_N_DECL(bernoulli, long, double p)
+DIST_GENERATE_N_DEFN(bernoulli, long, p)
+DIST_GENERATE_PARALLEL_DECL(bernoulli, long, double p)
+DIST_GENERATE_PARALLEL_DEFN(bernoulli, long, p)
+
+uint64_t *dist_bernoulli_generate_bits_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, uint64_t *res, long count, double p)
+{
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	x::random::bernoulli_distribution<long> d(p);
+	DIST_DISPATCH(d.sample_bits(rngd, res, count));
+	return res;
+}
+
+uint64_t *dist_bernoulli_generate_bits(x_rng *rng, uint64_t *res, long count, double p)
+{
+	return dist_bernoulli_generate_bits_with_callback(rng, NULL, res, count, p);
+}
 
 DIST_GENERATE_WITH_CALLBACK_DECL(binomial, long, long t, double p)
 DIST_GENERATE_WITH_CALLBACK_DEFN(binomial, long, t, p)
 DIST_GENERATE_DECL(binomial, long, long t, double p)
 DIST_GENERATE_DEFN(binomial, long, t, p)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(binomial, long, long t, double p)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(binomial, long, t, p)
+DIST_GENERATE_N_DECL(binomial, long, long t, double p)
+DIST_GENERATE_N_DEFN(binomial, long, t, p)
+DIST_GENERATE_PARALLEL_DECL(binomial, long, long t, double p)
+DIST_GENERATE_PARALLEL_DEFN(binomial, long, t, p)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(geometric, long, double p)
 DIST_GENERATE_WITH_CALLBACK_DEFN(geometric, long, p)
 DIST_GENERATE_DECL(geometric, long, double p)
 DIST_GENERATE_DEFN(geometric, long, p)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(geometric, long, double p)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(geometric, long, p)
+DIST_GENERATE_N_DECL(geometric, long, double p)
+DIST_GENERATE_N_DEFN(geometric, long, p)
+DIST_GENERATE_PARALLEL_DECL(geometric, long, double p)
+DIST_GENERATE_PARALLEL_DEFN(geometric, long, p)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(negative_binomial, long, long t, double p)
 DIST_GENERATE_WITH_CALLBACK_DEFN(negative_binomial, long, t, p)
 DIST_GENERATE_DECL(negative_binomial, long, long t, double p)
 DIST_GENERATE_DEFN(negative_binomial, long, t, p)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(negative_binomial, long, long t, double p)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(negative_binomial, long, t, p)
+DIST_GENERATE_N_DECL(negative_binomial, long, long t, double p)
+DIST_GENERATE_N_DEFN(negative_binomial, long, t, p)
+DIST_GENERATE_PARALLEL_DECL(negative_binomial, long, long t, double p)
+DIST_GENERATE_PARALLEL_DEFN(negative_binomial, long, t, p)
 
 long *dist_multinomial_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long n, long buflen, double *p, long *res)
 {
@@ -409,27 +892,54 @@ long *dist_multinomial_generate_with_callback(x_rng *rng, xobj_uint32_callback r
 	uint64_t rng_max = rng->max;
 	uint64_t buf = 0;
 	x::random::multinomial_distribution<long> d(n, p, p + buflen);
-	std::vector<long> ret;
-	DIST_CALL_SWITCH(ret);
-	long _n = buflen;
-	if(ret.size() < _n){
-		_n = ret.size();
-	}
-	for(long i = 0; i < _n; i++){
-		res[i] = ret[i];
-	}
+	DIST_DISPATCH(d.sample(rngd, res));
 	return res;
 }
 
 long *dist_multinomial_generate(x_rng *rng, long n, long buflen, double *p, long *res)
 {
-	return dist_multinomial_generate_with_callback(rng, def_rng_delegate_uint32_callback, n, buflen, p, res);
+	return dist_multinomial_generate_with_callback(rng, NULL, n, buflen, p, res);
+}
+
+long *dist_multinomial_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long *res, long count, long n, long buflen, double *p)
+{
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	x::random::multinomial_distribution<long> d(n, p, p + buflen);
+	DIST_DISPATCH(for(long i = 0; i < count; i++){d.sample(rngd, res + i * buflen);});
+	return res;
+}
+
+long *dist_multinomial_generate_n(x_rng *rng, long *res, long count, long n, long buflen, double *p)
+{
+	return dist_multinomial_generate_n_with_callback(rng, NULL, res, count, n, buflen, p);
+}
+
+long dist_multinomial_generate_sparse_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long n, long buflen, double *p, long *idx, long *counts)
+{
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	x::random::multinomial_distribution<long> d(n, p, p + buflen);
+	long m = 0;
+	DIST_DISPATCH(m = d.sample_sparse(rngd, idx, counts));
+	return m;
+}
+
+long dist_multinomial_generate_sparse(x_rng *rng, long n, long buflen, double *p, long *idx, long *counts)
+{
+	return dist_multinomial_generate_sparse_with_callback(rng, NULL, n, buflen, p, idx, counts);
 }
 
 DIST_GENERATE_WITH_CALLBACK_DECL(hypergeometric, long, long n, long M, long N)
 DIST_GENERATE_WITH_CALLBACK_DEFN(hypergeometric, long, n, M, N)
 DIST_GENERATE_DECL(hypergeometric, long, long n, long M, long N)
 DIST_GENERATE_DEFN(hypergeometric, long, n, M, N)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(hypergeometric, long, long n, long M, long N)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(hypergeometric, long, n, M, N)
+DIST_GENERATE_N_DECL(hypergeometric, long, long n, long M, long N)
+DIST_GENERATE_N_DEFN(hypergeometric, long, n, M, N)
+DIST_GENERATE_PARALLEL_DECL(hypergeometric, long, long n, long M, long N)
+DIST_GENERATE_PARALLEL_DEFN(hypergeometric, long, n, M, N)
 
 long *dist_multivariate_hypergeometric_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long n, long buflen, long *M, long *res)
 {
@@ -437,47 +947,83 @@ long *dist_multivariate_hypergeometric_generate_with_callback(x_rng *rng, xobj_u
 	uint64_t rng_max = rng->max;
 	uint64_t buf = 0;
 	x::random::multivariate_hypergeometric_distribution<long> d(n, M, M + buflen);
-	std::vector<long> ret;
-	DIST_CALL_SWITCH(ret);
-	long _n = buflen;
-	if(ret.size() < _n){
-		_n = ret.size();
-	}
-	for(long i = 0; i < _n; i++){
-		res[i] = ret[i];
-	}
+	DIST_DISPATCH(d.sample(rngd, res));
 	return res;
 }
 
 long *dist_multivariate_hypergeometric_generate(x_rng *rng, long n, long buflen, long *M, long *res)
 {
-	return dist_multivariate_hypergeometric_generate_with_callback(rng, def_rng_delegate_uint32_callback, n, buflen, M, res);
+	return dist_multivariate_hypergeometric_generate_with_callback(rng, NULL, n, buflen, M, res);
+}
+
+long *dist_multivariate_hypergeometric_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long *res, long count, long n, long buflen, long *M)
+{
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	x::random::multivariate_hypergeometric_distribution<long> d(n, M, M + buflen);
+	DIST_DISPATCH(for(long i = 0; i < count; i++){d.sample(rngd, res + i * buflen);});
+	return res;
+}
+
+long *dist_multivariate_hypergeometric_generate_n(x_rng *rng, long *res, long count, long n, long buflen, long *M)
+{
+	return dist_multivariate_hypergeometric_generate_n_with_callback(rng, NULL, res, count, n, buflen, M);
 }
 
 DIST_GENERATE_WITH_CALLBACK_DECL(poisson, long, double mean)
 DIST_GENERATE_WITH_CALLBACK_DEFN(poisson, long, mean)
 DIST_GENERATE_DECL(poisson, long, double mean)
 DIST_GENERATE_DEFN(poisson, long, mean)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(poisson, long, double mean)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(poisson, long, mean)
+DIST_GENERATE_N_DECL(poisson, long, double mean)
+DIST_GENERATE_N_DEFN(poisson, long, mean)
+DIST_GENERATE_PARALLEL_DECL(poisson, long, double mean)
+DIST_GENERATE_PARALLEL_DEFN(poisson, long, mean)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(exponential, double, double lambda)
 DIST_GENERATE_WITH_CALLBACK_DEFN(exponential, double, lambda)
 DIST_GENERATE_DECL(exponential, double, double lambda)
 DIST_GENERATE_DEFN(exponential, double, lambda)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(exponential, double, double lambda)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(exponential, double, lambda)
+DIST_GENERATE_N_DECL(exponential, double, double lambda)
+DIST_GENERATE_N_DEFN(exponential, double, lambda)
+DIST_GENERATE_PARALLEL_DECL(exponential, double, double lambda)
+DIST_GENERATE_PARALLEL_DEFN(exponential, double, lambda)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(gamma, double, double alpha, double beta)
 DIST_GENERATE_WITH_CALLBACK_DEFN(gamma, double, alpha, beta)
 DIST_GENERATE_DECL(gamma, double, double alpha, double beta)
 DIST_GENERATE_DEFN(gamma, double, alpha, beta)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(gamma, double, double alpha, double beta)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(gamma, double, alpha, beta)
+DIST_GENERATE_N_DECL(gamma, double, double alpha, double beta)
+DIST_GENERATE_N_DEFN(gamma, double, alpha, beta)
+DIST_GENERATE_PARALLEL_DECL(gamma, double, double alpha, double beta)
+DIST_GENERATE_PARALLEL_DEFN(gamma, double, alpha, beta)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(weibull, double, double a, double b)
 DIST_GENERATE_WITH_CALLBACK_DEFN(weibull, double, a, b)
 DIST_GENERATE_DECL(weibull, double, double a, double b)
 DIST_GENERATE_DEFN(weibull, double, a, b)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(weibull, double, double a, double b)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(weibull, double, a, b)
+DIST_GENERATE_N_DECL(weibull, double, double a, double b)
+DIST_GENERATE_N_DEFN(weibull, double, a, b)
+DIST_GENERATE_PARALLEL_DECL(weibull, double, double a, double b)
+DIST_GENERATE_PARALLEL_DEFN(weibull, double, a, b)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(extreme_value, double, double a, double b)
 DIST_GENERATE_WITH_CALLBACK_DEFN(extreme_value, double, a, b)
 DIST_GENERATE_DECL(extreme_value, double, double a, double b)
 DIST_GENERATE_DEFN(extreme_value, double, a, b)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(extreme_value, double, double a, double b)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(extreme_value, double, a, b)
+DIST_GENERATE_N_DECL(extreme_value, double, double a, double b)
+DIST_GENERATE_N_DEFN(extreme_value, double, a, b)
+DIST_GENERATE_PARALLEL_DECL(extreme_value, double, double a, double b)
+DIST_GENERATE_PARALLEL_DEFN(extreme_value, double, a, b)
 
 double *dist_dirichlet_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long buflen, double *alpha, double *res)
 {
@@ -486,7 +1032,7 @@ double *dist_dirichlet_generate_with_callback(x_rng *rng, xobj_uint32_callback r
 	uint64_t buf = 0;
 	x::random::dirichlet_distribution<double> d(alpha, alpha + buflen);
 	std::vector<double> ret;
-	DIST_CALL_SWITCH(ret);
+	DIST_DISPATCH(ret = d(rngd));
 	long _n = buflen;
 	if(ret.size() < _n){
 		_n = ret.size();
@@ -499,64 +1045,155 @@ double *dist_dirichlet_generate_with_callback(x_rng *rng, xobj_uint32_callback r
 
 double *dist_dirichlet_generate(x_rng *rng, long buflen, double *alpha, double *res)
 {
-	return dist_dirichlet_generate_with_callback(rng, def_rng_delegate_uint32_callback, buflen, alpha, res);
+	return dist_dirichlet_generate_with_callback(rng, NULL, buflen, alpha, res);
+}
+
+double *dist_dirichlet_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count, long buflen, double *alpha)
+{
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	x::random::dirichlet_distribution<double> d(alpha, alpha + buflen);
+	DIST_DISPATCH(for(long i = 0; i < count; i++){std::vector<double> ret = d(rngd); DIST_COPY_VECTOR(ret, (res + i * buflen), buflen);});
+	return res;
+}
+
+double *dist_dirichlet_generate_n(x_rng *rng, double *res, long count, long buflen, double *alpha)
+{
+	return dist_dirichlet_generate_n_with_callback(rng, NULL, res, count, buflen, alpha);
 }
 
 DIST_GENERATE_WITH_CALLBACK_DECL(beta, double, double alpha, double beta)
 DIST_GENERATE_WITH_CALLBACK_DEFN(beta, double, alpha, beta)
 DIST_GENERATE_DECL(beta, double, double alpha, double beta)
 DIST_GENERATE_DEFN(beta, double, alpha, beta)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(beta, double, double alpha, double beta)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(beta, double, alpha, beta)
+DIST_GENERATE_N_DECL(beta, double, double alpha, double beta)
+DIST_GENERATE_N_DEFN(beta, double, alpha, beta)
+DIST_GENERATE_PARALLEL_DECL(beta, double, double alpha, double beta)
+DIST_GENERATE_PARALLEL_DEFN(beta, double, alpha, beta)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(kumaraswamy, double, double alpha, double beta)
 DIST_GENERATE_WITH_CALLBACK_DEFN(kumaraswamy, double, alpha, beta)
 DIST_GENERATE_DECL(kumaraswamy, double, double alpha, double beta)
 DIST_GENERATE_DEFN(kumaraswamy, double, alpha, beta)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(kumaraswamy, double, double alpha, double beta)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(kumaraswamy, double, alpha, beta)
+DIST_GENERATE_N_DECL(kumaraswamy, double, double alpha, double beta)
+DIST_GENERATE_N_DEFN(kumaraswamy, double, alpha, beta)
+DIST_GENERATE_PARALLEL_DECL(kumaraswamy, double, double alpha, double beta)
+DIST_GENERATE_PARALLEL_DEFN(kumaraswamy, double, alpha, beta)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(laplace, double, double mu, double sigma)
 DIST_GENERATE_WITH_CALLBACK_DEFN(laplace, double, mu, sigma)
 DIST_GENERATE_DECL(laplace, double, double mu, double sigma)
 DIST_GENERATE_DEFN(laplace, double, mu, sigma)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(laplace, double, double mu, double sigma)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(laplace, double, mu, sigma)
+DIST_GENERATE_N_DECL(laplace, double, double mu, double sigma)
+DIST_GENERATE_N_DEFN(laplace, double, mu, sigma)
+DIST_GENERATE_PARALLEL_DECL(laplace, double, double mu, double sigma)
+DIST_GENERATE_PARALLEL_DEFN(laplace, double, mu, sigma)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(erlang, double, long k, double lambda)
 DIST_GENERATE_WITH_CALLBACK_DEFN(erlang, double, k, lambda)
 DIST_GENERATE_DECL(erlang, double, double k, double lambda)
 DIST_GENERATE_DEFN(erlang, double, k, lambda)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(erlang, double, long k, double lambda)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(erlang, double, k, lambda)
+DIST_GENERATE_N_DECL(erlang, double, long k, double lambda)
+DIST_GENERATE_N_DEFN(erlang, double, k, lambda)
+DIST_GENERATE_PARALLEL_DECL(erlang, double, long k, double lambda)
+DIST_GENERATE_PARALLEL_DEFN(erlang, double, k, lambda)
+
+DIST_GENERATE_WITH_CALLBACK_DECL(gaussian_tail, double, double a, double sigma, int table)
+DIST_GENERATE_WITH_CALLBACK_DEFN(gaussian_tail, double, a, sigma, table)
+DIST_GENERATE_DECL(gaussian_tail, double, double a, double sigma, int table)
+DIST_GENERATE_DEFN(gaussian_tail, double, a, sigma, table)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(gaussian_tail, double, double a, double sigma, int table)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(gaussian_tail, double, a, sigma, table)
+DIST_GENERATE_N_DECL(gaussian_tail, double, double a, double sigma, int table)
+DIST_GENERATE_N_DEFN(gaussian_tail, double, a, sigma, table)
+DIST_GENERATE_PARALLEL_DECL(gaussian_tail, double, double a, double sigma, int table)
+DIST_GENERATE_PARALLEL_DEFN(gaussian_tail, double, a, sigma, table)
 
 
 DIST_GENERATE_WITH_CALLBACK_DECL(normal, double, double mean, double stddev)
 DIST_GENERATE_WITH_CALLBACK_DEFN(normal, double, mean, stddev)
 DIST_GENERATE_DECL(normal, double, double mean, double stddev)
 DIST_GENERATE_DEFN(normal, double, mean, stddev)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(normal, double, double mean, double stddev)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(normal, double, mean, stddev)
+DIST_GENERATE_N_DECL(normal, double, double mean, double stddev)
+DIST_GENERATE_N_DEFN(normal, double, mean, stddev)
+DIST_GENERATE_PARALLEL_DECL(normal, double, double mean, double stddev)
+DIST_GENERATE_PARALLEL_DEFN(normal, double, mean, stddev)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(lognormal, double, double m, double s)
 DIST_GENERATE_WITH_CALLBACK_DEFN(lognormal, double, m, s)
 DIST_GENERATE_DECL(lognormal, double, double m, double s)
 DIST_GENERATE_DEFN(lognormal, double, m, s)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(lognormal, double, double m, double s)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(lognormal, double, m, s)
+DIST_GENERATE_N_DECL(lognormal, double, double m, double s)
+DIST_GENERATE_N_DEFN(lognormal, double, m, s)
+DIST_GENERATE_PARALLEL_DECL(lognormal, double, double m, double s)
+DIST_GENERATE_PARALLEL_DEFN(lognormal, double, m, s)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(chi_squared, double, double n)
 DIST_GENERATE_WITH_CALLBACK_DEFN(chi_squared, double, n)
 DIST_GENERATE_DECL(chi_squared, double, double n)
 DIST_GENERATE_DEFN(chi_squared, double, n)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(chi_squared, double, double n)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(chi_squared, double, n)
+DIST_GENERATE_N_DECL(chi_squared, double, double n)
+DIST_GENERATE_N_DEFN(chi_squared, double, n)
+DIST_GENERATE_PARALLEL_DECL(chi_squared, double, double n)
+DIST_GENERATE_PARALLEL_DEFN(chi_squared, double, n)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(cauchy, double, double a, double b)
 DIST_GENERATE_WITH_CALLBACK_DEFN(cauchy, double, a, b)
 DIST_GENERATE_DECL(cauchy, double, double a, double b)
 DIST_GENERATE_DEFN(cauchy, double, a, b)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(cauchy, double, double a, double b)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(cauchy, double, a, b)
+DIST_GENERATE_N_DECL(cauchy, double, double a, double b)
+DIST_GENERATE_N_DEFN(cauchy, double, a, b)
+DIST_GENERATE_PARALLEL_DECL(cauchy, double, double a, double b)
+DIST_GENERATE_PARALLEL_DEFN(cauchy, double, a, b)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(fisher_f, double, double m, double n)
 DIST_GENERATE_WITH_CALLBACK_DEFN(fisher_f, double, m, n)
 DIST_GENERATE_DECL(fisher_f, double, double m, double n)
 DIST_GENERATE_DEFN(fisher_f, double, m, n)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(fisher_f, double, double m, double n)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(fisher_f, double, m, n)
+DIST_GENERATE_N_DECL(fisher_f, double, double m, double n)
+DIST_GENERATE_N_DEFN(fisher_f, double, m, n)
+DIST_GENERATE_PARALLEL_DECL(fisher_f, double, double m, double n)
+DIST_GENERATE_PARALLEL_DEFN(fisher_f, double, m, n)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(student_t, double, double n)
 DIST_GENERATE_WITH_CALLBACK_DEFN(student_t, double, n)
 DIST_GENERATE_DECL(student_t, double, double n)
 DIST_GENERATE_DEFN(student_t, double, n)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(student_t, double, double n)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(student_t, double, n)
+DIST_GENERATE_N_DECL(student_t, double, double n)
+DIST_GENERATE_N_DEFN(student_t, double, n)
+DIST_GENERATE_PARALLEL_DECL(student_t, double, double n)
+DIST_GENERATE_PARALLEL_DEFN(student_t, double, n)
 
 DIST_GENERATE_WITH_CALLBACK_DECL(rayleigh, double, double sigma)
 DIST_GENERATE_WITH_CALLBACK_DEFN(rayleigh, double, sigma)
 DIST_GENERATE_DECL(rayleigh, double, double sigma)
 DIST_GENERATE_DEFN(rayleigh, double, sigma)
+DIST_GENERATE_N_WITH_CALLBACK_DECL(rayleigh, double, double sigma)
+DIST_GENERATE_N_WITH_CALLBACK_DEFN(rayleigh, double, sigma)
+DIST_GENERATE_N_DECL(rayleigh, double, double sigma)
+DIST_GENERATE_N_DEFN(rayleigh, double, sigma)
+DIST_GENERATE_PARALLEL_DECL(rayleigh, double, double sigma)
+DIST_GENERATE_PARALLEL_DEFN(rayleigh, double, sigma)
 
 
 long dist_discrete_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long buflen, double *probabilities)
@@ -565,14 +1202,35 @@ long dist_discrete_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_d
 	uint64_t rng_max = rng->max;
 	uint64_t buf = 0;
 	x::random::discrete_distribution<long> d(probabilities, probabilities + buflen);
-	long ret;
-	DIST_CALL_SWITCH(ret);
+	long ret = 0;
+	DIST_DISPATCH(ret = d(rngd));
 	return ret;
 }
 
 long dist_discrete_generate(x_rng *rng, long buflen, double *probabilities)
 {
-	return dist_discrete_generate_with_callback(rng, def_rng_delegate_uint32_callback, buflen, probabilities);
+	return dist_discrete_generate_with_callback(rng, NULL, buflen, probabilities);
+}
+
+long *dist_discrete_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long *res, long count, long buflen, double *probabilities)
+{
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	x::random::discrete_distribution<long> d(probabilities, probabilities + buflen);
+	DIST_DISPATCH(x::random::generate(d, res, res + count, rngd));
+	return res;
+}
+
+long *dist_discrete_generate_n(x_rng *rng, long *res, long count, long buflen, double *probabilities)
+{
+	return dist_discrete_generate_n_with_callback(rng, NULL, res, count, buflen, probabilities);
+}
+
+long *dist_discrete_generate_parallel(x_rng *rng, long *res, long count, long nthreads, long buflen, double *probabilities)
+{
+	x::random::discrete_distribution<long> d(probabilities, probabilities + buflen);
+	DIST_PARALLEL_SWITCH(dist_discrete_generate_n(rng, res, count, buflen, probabilities));
+	return res;
 }
 
 // piecewise constant
@@ -582,14 +1240,35 @@ double dist_piecewise_constant_generate_with_callback(x_rng *rng, xobj_uint32_ca
 	uint64_t rng_max = rng->max;
 	uint64_t buf = 0;
 	x::random::piecewise_constant_distribution<double> d(intervals, intervals + intervals_len, densities);
-	double ret;
-	DIST_CALL_SWITCH(ret);
+	double ret = 0;
+	DIST_DISPATCH(ret = d(rngd));
 	return ret;
 }
 
 double dist_piecewise_constant_generate(x_rng *rng, long intervals_len, double *intervals, double *densities)
 {
-	return dist_piecewise_constant_generate_with_callback(rng, def_rng_delegate_uint32_callback, intervals_len, intervals, densities);
+	return dist_piecewise_constant_generate_with_callback(rng, NULL, intervals_len, intervals, densities);
+}
+
+double *dist_piecewise_constant_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count, long intervals_len, double *intervals, double *densities)
+{
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	x::random::piecewise_constant_distribution<double> d(intervals, intervals + intervals_len, densities);
+	DIST_DISPATCH(for(long i = 0; i < count; i++){res[i] = d(rngd);});
+	return res;
+}
+
+double *dist_piecewise_constant_generate_n(x_rng *rng, double *res, long count, long intervals_len, double *intervals, double *densities)
+{
+	return dist_piecewise_constant_generate_n_with_callback(rng, NULL, res, count, intervals_len, intervals, densities);
+}
+
+double *dist_piecewise_constant_generate_parallel(x_rng *rng, double *res, long count, long nthreads, long intervals_len, double *intervals, double *densities)
+{
+	x::random::piecewise_constant_distribution<double> d(intervals, intervals + intervals_len, densities);
+	DIST_PARALLEL_SWITCH(dist_piecewise_constant_generate_n(rng, res, count, intervals_len, intervals, densities));
+	return res;
 }
 
 double dist_piecewise_linear_generate_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, long intervals_len, double *intervals, double *densities)
@@ -598,16 +1277,265 @@ double dist_piecewise_linear_generate_with_callback(x_rng *rng, xobj_uint32_call
 	uint64_t rng_max = rng->max;
 	uint64_t buf = 0;
 	x::random::piecewise_linear_distribution<double> d(intervals, intervals + intervals_len, densities);
-	double ret;
-	DIST_CALL_SWITCH(ret);
+	double ret = 0;
+	DIST_DISPATCH(ret = d(rngd));
 	return ret;
 }
 
 double dist_piecewise_linear_generate(x_rng *rng, long intervals_len, double *intervals, double *densities)
 {
-	return dist_piecewise_linear_generate_with_callback(rng, def_rng_delegate_uint32_callback, intervals_len, intervals, densities);
+	return dist_piecewise_linear_generate_with_callback(rng, NULL, intervals_len, intervals, densities);
+}
+
+double *dist_piecewise_linear_generate_n_with_callback(x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count, long intervals_len, double *intervals, double *densities)
+{
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	x::random::piecewise_linear_distribution<double> d(intervals, intervals + intervals_len, densities);
+	DIST_DISPATCH(for(long i = 0; i < count; i++){res[i] = d(rngd);});
+	return res;
+}
+
+double *dist_piecewise_linear_generate_n(x_rng *rng, double *res, long count, long intervals_len, double *intervals, double *densities)
+{
+	return dist_piecewise_linear_generate_n_with_callback(rng, NULL, res, count, intervals_len, intervals, densities);
+}
+
+double *dist_piecewise_linear_generate_parallel(x_rng *rng, double *res, long count, long nthreads, long intervals_len, double *intervals, double *densities)
+{
+	x::random::piecewise_linear_distribution<double> d(intervals, intervals + intervals_len, densities);
+	DIST_PARALLEL_SWITCH(dist_piecewise_linear_generate_n(rng, res, count, intervals_len, intervals, densities));
+	return res;
 }
 
 // piecewise linear
 
+//////////////////////////////////////////////////
+// distribution handles
+//////////////////////////////////////////////////
+
+struct x_dist
+{
+	void *myobj;
+	double (*sample)(x_dist *x, x_rng *rng, xobj_uint32_callback rng_delegate_callback);
+	double *(*sample_n)(x_dist *x, x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count);
+	void (*free)(x_dist *x);
+};
+
+} // extern "C"
+
+template <typename dist_type>
+static double dist_handle_sample(x_dist *x, x_rng *rng, xobj_uint32_callback rng_delegate_callback)
+{
+	dist_type &d = *reinterpret_cast<dist_type*>(x->myobj);
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	typename dist_type::result_type ret = 0;
+	DIST_DISPATCH(ret = d(rngd));
+	return ret;
+}
+
+template <typename dist_type>
+static double *dist_handle_sample_n(x_dist *x, x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count)
+{
+	dist_type &d = *reinterpret_cast<dist_type*>(x->myobj);
+	uint64_t rng_min = rng->min;
+	uint64_t rng_max = rng->max;
+	DIST_DISPATCH(x::random::generate(d, res, res + count, rngd));
+	return res;
+}
+
+template <typename dist_type>
+static void dist_handle_free(x_dist *x)
+{
+	delete reinterpret_cast<dist_type*>(x->myobj);
+}
+
+template <typename dist_type>
+static x_dist *dist_handle_new(dist_type *d)
+{
+	x_dist *x = (x_dist *)calloc(1, sizeof(x_dist));
+	x->myobj = d;
+	x->sample = dist_handle_sample<dist_type>;
+	x->sample_n = dist_handle_sample_n<dist_type>;
+	x->free = dist_handle_free<dist_type>;
+	return x;
+}
+
+extern "C" {
+
+#define DIST_NEW_DEFN(dist, dist_ret_type, ...)			\
+	{								\
+		return dist_handle_new(new x::random::dist##_distribution<dist_ret_type>(__VA_ARGS__)); \
+	}
+
+#define DIST_SET_PARAMS_DEFN(dist, dist_ret_type, ...)			\
+	{								\
+		using dist_type = x::random::dist##_distribution<dist_ret_type>; \
+		reinterpret_cast<dist_type*>(d->myobj)->param(dist_type::param_type(__VA_ARGS__)); \
+	}
+
+DIST_NEW_DECL(uniform_int, long a, long b)
+DIST_NEW_DEFN(uniform_int, long, a, b)
+DIST_SET_PARAMS_DECL(uniform_int, long a, long b)
+DIST_SET_PARAMS_DEFN(uniform_int, long, a, b)
+
+DIST_NEW_DECL(uniform_real, double a, double b)
+DIST_NEW_DEFN(uniform_real, double, a, b)
+DIST_SET_PARAMS_DECL(uniform_real, double a, double b)
+DIST_SET_PARAMS_DEFN(uniform_real, double, a, b)
+
+DIST_NEW_DECL(bernoulli, double p)
+DIST_NEW_DEFN(bernoulli, long, p)
+DIST_SET_PARAMS_DECL(bernoulli, double p)
+DIST_SET_PARAMS_DEFN(bernoulli, long, p)
+
+DIST_NEW_DECL(binomial, long t, double p)
+DIST_NEW_DEFN(binomial, long, t, p)
+DIST_SET_PARAMS_DECL(binomial, long t, double p)
+DIST_SET_PARAMS_DEFN(binomial, long, t, p)
+
+DIST_NEW_DECL(geometric, double p)
+DIST_NEW_DEFN(geometric, long, p)
+DIST_SET_PARAMS_DECL(geometric, double p)
+DIST_SET_PARAMS_DEFN(geometric, long, p)
+
+DIST_NEW_DECL(negative_binomial, long t, double p)
+DIST_NEW_DEFN(negative_binomial, long, t, p)
+DIST_SET_PARAMS_DECL(negative_binomial, long t, double p)
+DIST_SET_PARAMS_DEFN(negative_binomial, long, t, p)
+
+DIST_NEW_DECL(hypergeometric, long n, long M, long N)
+DIST_NEW_DEFN(hypergeometric, long, n, M, N)
+DIST_SET_PARAMS_DECL(hypergeometric, long n, long M, long N)
+DIST_SET_PARAMS_DEFN(hypergeometric, long, n, M, N)
+
+DIST_NEW_DECL(poisson, double mean)
+DIST_NEW_DEFN(poisson, long, mean)
+DIST_SET_PARAMS_DECL(poisson, double mean)
+DIST_SET_PARAMS_DEFN(poisson, long, mean)
+
+DIST_NEW_DECL(exponential, double lambda)
+DIST_NEW_DEFN(exponential, double, lambda)
+DIST_SET_PARAMS_DECL(exponential, double lambda)
+DIST_SET_PARAMS_DEFN(exponential, double, lambda)
+
+DIST_NEW_DECL(gamma, double alpha, double beta)
+DIST_NEW_DEFN(gamma, double, alpha, beta)
+DIST_SET_PARAMS_DECL(gamma, double alpha, double beta)
+DIST_SET_PARAMS_DEFN(gamma, double, alpha, beta)
+
+DIST_NEW_DECL(weibull, double a, double b)
+DIST_NEW_DEFN(weibull, double, a, b)
+DIST_SET_PARAMS_DECL(weibull, double a, double b)
+DIST_SET_PARAMS_DEFN(weibull, double, a, b)
+
+DIST_NEW_DECL(extreme_value, double a, double b)
+DIST_NEW_DEFN(extreme_value, double, a, b)
+DIST_SET_PARAMS_DECL(extreme_value, double a, double b)
+DIST_SET_PARAMS_DEFN(extreme_value, double, a, b)
+
+DIST_NEW_DECL(beta, double alpha, double beta)
+DIST_NEW_DEFN(beta, double, alpha, beta)
+DIST_SET_PARAMS_DECL(beta, double alpha, double beta)
+DIST_SET_PARAMS_DEFN(beta, double, alpha, beta)
+
+DIST_NEW_DECL(kumaraswamy, double alpha, double beta)
+DIST_NEW_DEFN(kumaraswamy, double, alpha, beta)
+DIST_SET_PARAMS_DECL(kumaraswamy, double alpha, double beta)
+DIST_SET_PARAMS_DEFN(kumaraswamy, double, alpha, beta)
+
+DIST_NEW_DECL(laplace, double mu, double sigma)
+DIST_NEW_DEFN(laplace, double, mu, sigma)
+DIST_SET_PARAMS_DECL(laplace, double mu, double sigma)
+DIST_SET_PARAMS_DEFN(laplace, double, mu, sigma)
+
+DIST_NEW_DECL(erlang, long k, double lambda)
+DIST_NEW_DEFN(erlang, double, k, lambda)
+DIST_SET_PARAMS_DECL(erlang, long k, double lambda)
+DIST_SET_PARAMS_DEFN(erlang, double, k, lambda)
+
+DIST_NEW_DECL(gaussian_tail, double a, double sigma, int table)
+DIST_NEW_DEFN(gaussian_tail, double, a, sigma, table != 0)
+DIST_SET_PARAMS_DECL(gaussian_tail, double a, double sigma, int table)
+DIST_SET_PARAMS_DEFN(gaussian_tail, double, a, sigma, table != 0)
+
+DIST_NEW_DECL(normal, double mean, double stddev)
+DIST_NEW_DEFN(normal, double, mean, stddev)
+DIST_SET_PARAMS_DECL(normal, double mean, double stddev)
+DIST_SET_PARAMS_DEFN(normal, double, mean, stddev)
+
+DIST_NEW_DECL(lognormal, double m, double s)
+DIST_NEW_DEFN(lognormal, double, m, s)
+DIST_SET_PARAMS_DECL(lognormal, double m, double s)
+DIST_SET_PARAMS_DEFN(lognormal, double, m, s)
+
+DIST_NEW_DECL(chi_squared, double n)
+DIST_NEW_DEFN(chi_squared, double, n)
+DIST_SET_PARAMS_DECL(chi_squared, double n)
+DIST_SET_PARAMS_DEFN(chi_squared, double, n)
+
+DIST_NEW_DECL(cauchy, double a, double b)
+DIST_NEW_DEFN(cauchy, double, a, b)
+DIST_SET_PARAMS_DECL(cauchy, double a, double b)
+DIST_SET_PARAMS_DEFN(cauchy, double, a, b)
+
+DIST_NEW_DECL(fisher_f, double m, double n)
+DIST_NEW_DEFN(fisher_f, double, m, n)
+DIST_SET_PARAMS_DECL(fisher_f, double m, double n)
+DIST_SET_PARAMS_DEFN(fisher_f, double, m, n)
+
+DIST_NEW_DECL(student_t, double n)
+DIST_NEW_DEFN(student_t, double, n)
+DIST_SET_PARAMS_DECL(student_t, double n)
+DIST_SET_PARAMS_DEFN(student_t, double, n)
+
+DIST_NEW_DECL(rayleigh, double sigma)
+DIST_NEW_DEFN(rayleigh, double, sigma)
+DIST_SET_PARAMS_DECL(rayleigh, double sigma)
+DIST_SET_PARAMS_DEFN(rayleigh, double, sigma)
+
+DIST_NEW_DECL(discrete, long buflen, double *probabilities)
+DIST_NEW_DEFN(discrete, long, probabilities, probabilities + buflen)
+DIST_SET_PARAMS_DECL(discrete, long buflen, double *probabilities)
+DIST_SET_PARAMS_DEFN(discrete, long, probabilities, probabilities + buflen)
+
+DIST_NEW_DECL(piecewise_constant, long intervals_len, double *intervals, double *densities)
+DIST_NEW_DEFN(piecewise_constant, double, intervals, intervals + intervals_len, densities)
+DIST_SET_PARAMS_DECL(piecewise_constant, long intervals_len, double *intervals, double *densities)
+DIST_SET_PARAMS_DEFN(piecewise_constant, double, intervals, intervals + intervals_len, densities)
+
+DIST_NEW_DECL(piecewise_linear, long intervals_len, double *intervals, double *densities)
+DIST_NEW_DEFN(piecewise_linear, double, intervals, intervals + intervals_len, densities)
+DIST_SET_PARAMS_DECL(piecewise_linear, long intervals_len, double *intervals, double *densities)
+DIST_SET_PARAMS_DEFN(piecewise_linear, double, intervals, intervals + intervals_len, densities)
+
+void dist_delete(x_dist *d)
+{
+	if(d){
+		d->free(d);
+		free(d);
+	}
+}
+
+double dist_sample_with_callback(x_dist *d, x_rng *rng, xobj_uint32_callback rng_delegate_callback)
+{
+	return d->sample(d, rng, rng_delegate_callback);
+}
+
+double dist_sample(x_dist *d, x_rng *rng)
+{
+	return d->sample(d, rng, NULL);
+}
+
+double *dist_sample_n_with_callback(x_dist *d, x_rng *rng, xobj_uint32_callback rng_delegate_callback, double *res, long count)
+{
+	return d->sample_n(d, rng, rng_delegate_callback, res, count);
+}
+
+double *dist_sample_n(x_dist *d, x_rng *rng, double *res, long count)
+{
+	return d->sample_n(d, rng, NULL, res, count);
+}
+
 } // extern "C"
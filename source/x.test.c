@@ -22,10 +22,343 @@ SOFTWARE.
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
+#include <math.h>
 #include "x.capi.h"
 #include "x.capi-callbacks.h"
 
+// hands out the same seed every time, so that rngs made from it start
+// in the same state
+void fixed_seed_callback(x_random_device *x, size_t n)
+{
+	if(*(x->n) < n || !(*(x->buf))){
+		*(x->buf) = (uint32_t *)realloc(*(x->buf), n * sizeof(uint32_t));
+		*(x->n) = n;
+	}
+	for(size_t i = 0; i < n; i++){
+		(*(x->buf))[i] = 0x9E3779B9 * (i + 1);
+	}
+}
+
+// the output of dist_<dist>_generate_parallel must not depend on the
+// number of threads
+int test_generate_parallel(x_random_device *rd)
+{
+	x_seed_seq_from *ssf = seed_seq_from_new_with_callback(rd, (xobj_uint32_callback)fixed_seed_callback);
+	x_seed_seq_from_delegate *ssfd = seed_seq_from_delegate_new(ssf);
+	x_rng *(*rng_new[])(x_seed_seq_from_delegate *) = {rng_pcg32_new, rng_mt19937_new, rng_xoshiro256pp_new};
+	const char *names[] = {"pcg32", "mt19937", "xoshiro256pp"};
+	long count = 3 * X_DIST_PARALLEL_CHUNK + 1000;
+	double *a = (double *)malloc(count * sizeof(double));
+	double *b = (double *)malloc(count * sizeof(double));
+	int failed = 0;
+	for(int i = 0; i < sizeof(names) / sizeof(names[0]); i++){
+		x_rng *r1 = rng_new[i](ssfd);
+		x_rng *r7 = rng_new[i](ssfd);
+		dist_normal_generate_parallel(r1, a, count, 1, 0., 1.);
+		dist_normal_generate_parallel(r7, b, count, 7, 0., 1.);
+		int same = memcmp(a, b, count * sizeof(double)) == 0 && rng_generate(r1) == rng_generate(r7);
+		printf("generate_parallel %s: nthreads 1 and 7 %s\n", names[i], same ? "agree" : "DIFFER");
+		failed |= !same;
+		rng_delete(r1);
+		rng_delete(r7);
+	}
+	free(a);
+	free(b);
+	seed_seq_from_delegate_delete(ssfd);
+	seed_seq_from_delete(ssf);
+	return failed;
+}
+
+// the key words the next rng made from kat_key_callback is seeded
+// with. the seed sequence asks for them one at a time, so they are
+// handed out from kat_key_pos on
+static uint32_t kat_key[8];
+static size_t kat_key_pos;
+
+void kat_key_callback(x_random_device *x, size_t n)
+{
+	if(*(x->n) < n || !(*(x->buf))){
+		*(x->buf) = (uint32_t *)realloc(*(x->buf), n * sizeof(uint32_t));
+		*(x->n) = n;
+	}
+	for(size_t i = 0; i < n; i++, kat_key_pos++){
+		(*(x->buf))[i] = kat_key_pos < sizeof(kat_key) / sizeof(kat_key[0]) ? kat_key[kat_key_pos] : 0;
+	}
+}
+
+// positions r on block blk of stream, which rng_seek can't reach
+// directly when blk * 4 overflows the index
+void kat_seek_block(x_rng *r, uint64_t stream, uint64_t blk)
+{
+	rng_seek(r, stream, (blk & 0x3FFFFFFFFFFFFFFFULL) * 4);
+	for(uint64_t i = 0; i < (blk >> 62) * 2; i++){
+		rng_advance(r, 0x8000000000000000ULL);
+	}
+}
+
+// known answers from the Random123 distribution (kat_vectors). philox
+// uses all four counter words as {blk, stream}, threefry only the
+// first two, so only its all zero vector is reachable from here
+int test_counter_kat(x_random_device *rd)
+{
+	static const struct {
+		uint32_t ctr[4], key[2], out[4];
+	} philox[] = {
+		{{0, 0, 0, 0}, {0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+		{{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}, {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+		{{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}, {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+	};
+	static const uint64_t threefry[4] = {0x09218ebde6c85537ULL, 0x55941f5266d86105ULL, 0x4bd25e16282434dcULL, 0xee29ec846bd2e40bULL};
+	x_seed_seq_from *ssf = seed_seq_from_new_with_callback(rd, (xobj_uint32_callback)kat_key_callback);
+	x_seed_seq_from_delegate *ssfd = seed_seq_from_delegate_new(ssf);
+	int failed = 0;
+	for(int i = 0; i < sizeof(philox) / sizeof(philox[0]); i++){
+		memset(kat_key, 0, sizeof(kat_key));
+		kat_key_pos = 0;
+		kat_key[0] = philox[i].key[0];
+		kat_key[1] = philox[i].key[1];
+		x_rng *r = rng_philox4x32_new(ssfd);
+		kat_seek_block(r, philox[i].ctr[2] | ((uint64_t)philox[i].ctr[3] << 32), philox[i].ctr[0] | ((uint64_t)philox[i].ctr[1] << 32));
+		int same = 1;
+		for(int j = 0; j < 4; j++){
+			same &= rng_generate(r) == philox[i].out[j];
+		}
+		printf("kat philox4x32 %d: %s\n", i, same ? "ok" : "WRONG");
+		failed |= !same;
+		rng_delete(r);
+	}
+	memset(kat_key, 0, sizeof(kat_key));
+	kat_key_pos = 0;
+	x_rng *r = rng_threefry4x64_new(ssfd);
+	int same = 1;
+	for(int j = 0; j < 4; j++){
+		same &= rng_generate(r) == threefry[j];
+	}
+	printf("kat threefry4x64: %s\n", same ? "ok" : "WRONG");
+	failed |= !same;
+	rng_delete(r);
+	seed_seq_from_delegate_delete(ssfd);
+	seed_seq_from_delete(ssf);
+	return failed;
+}
+
+// hands out the 64 bit words in script_words, from script_pos on
+static uint64_t script_words[4];
+static size_t script_pos;
+
+void script_callback(xobj_uint64 *x, size_t n)
+{
+	if(!(x->n) || !(x->buf) || *(x->n) < n){
+		*(x->buf) = (uint64_t *)realloc(*(x->buf), n * sizeof(uint64_t));
+		*(x->n) = n;
+	}
+	for(size_t i = 0; i < n; i++, script_pos++){
+		(*(x->buf))[i] = script_words[script_pos % (sizeof(script_words) / sizeof(script_words[0]))];
+	}
+}
+
+// uniform_int on a 64 bit engine: a range that fits in 32 bits is
+// drawn from a 32 bit product of the top of the word, so the low half
+// of the product is rejected below 2^32 mod s, and the counts of a
+// small range come out even
+int test_uniform_int(x_random_device *rd)
+{
+	x_seed_seq_from *ssf = seed_seq_from_new_with_callback(rd, (xobj_uint32_callback)fixed_seed_callback);
+	x_seed_seq_from_delegate *ssfd = seed_seq_from_delegate_new(ssf);
+	x_rng *r = rng_pcg64_new(ssfd);
+	int failed = 0;
+
+	// with s = 7 the threshold is 2^32 mod 7 = 4. 0xB6DB6DB7 is the
+	// inverse of 7 mod 2^32, so k * 0xB6DB6DB7 is the top half whose
+	// product with 7 has low half k
+	uint32_t below = 3u * 0xB6DB6DB7u, at = 4u * 0xB6DB6DB7u;
+	script_words[0] = (uint64_t)below << 32;
+	script_words[1] = (uint64_t)at << 32;
+	script_words[2] = script_words[3] = 0;
+	script_pos = 0;
+	rng_setblocklen(r, 1);
+	long x = dist_uniform_int_generate_with_callback(r, (xobj_uint32_callback)script_callback, 0, 6);
+	int ok = x == (long)(((uint64_t)at * 7) >> 32) && script_pos == 2;
+	printf("uniform_int threshold: %s\n", ok ? "ok" : "WRONG");
+	failed |= !ok;
+
+	long count = 7000000, counts[7] = {0};
+	long *res = (long *)malloc(count * sizeof(long));
+	dist_uniform_int_generate_n(r, res, count, 0, 6);
+	for(long i = 0; i < count; i++){
+		counts[res[i]]++;
+	}
+	double chi2 = 0;
+	for(int i = 0; i < 7; i++){
+		chi2 += (counts[i] - count / 7.) * (counts[i] - count / 7.) / (count / 7.);
+	}
+	// 6 degrees of freedom, p = 0.001
+	ok = chi2 < 22.46;
+	printf("uniform_int counts on pcg64: chi2 %f %s\n", chi2, ok ? "ok" : "WRONG");
+	failed |= !ok;
+	free(res);
+	rng_delete(r);
+	seed_seq_from_delegate_delete(ssfd);
+	seed_seq_from_delete(ssf);
+	return failed;
+}
+
+// rng_setuniformbits(r, 32) draws each uniform from one word of a
+// 32 bit rng, where the default of 53 bits takes two
+int test_uniform_bits(x_random_device *rd)
+{
+	x_seed_seq_from *ssf = seed_seq_from_new_with_callback(rd, (xobj_uint32_callback)fixed_seed_callback);
+	x_seed_seq_from_delegate *ssfd = seed_seq_from_delegate_new(ssf);
+	x_rng *r32 = rng_pcg32_new(ssfd);
+	x_rng *r53 = rng_pcg32_new(ssfd);
+	x_rng *w = rng_pcg32_new(ssfd);
+	long count = 1000;
+	double *res = (double *)malloc(count * sizeof(double));
+	int failed = 0;
+
+	rng_setuniformbits(r32, 32);
+	dist_uniform_real_generate_n(r32, res, count, 0., 1.);
+	int ok = rng_getuniformbits(r32) == 32 && res[0] == rng_generate(w) / 4294967296.;
+	dist_uniform_real_generate_n(r53, res, count, 0., 1.);
+	rng_advance(r32, count);
+	ok = ok && rng_getuniformbits(r53) == 53 && rng_generate(r32) == rng_generate(r53);
+	printf("uniform_bits 32 on pcg32: %s\n", ok ? "ok" : "WRONG");
+	failed |= !ok;
+	free(res);
+	rng_delete(r32);
+	rng_delete(r53);
+	rng_delete(w);
+	seed_seq_from_delegate_delete(ssfd);
+	seed_seq_from_delete(ssf);
+	return failed;
+}
+
+// minstd_rand words are 1..2^31 - 2. the samplers reject the top
+// 1/16 of them and keep the low 27 bits of the rest
+uint64_t minstd_bits27(x_rng *r)
+{
+	uint64_t x;
+	do{
+		x = rng_generate(r) - 1;
+	}while(x >= (uint64_t)15 << 27);
+	return x & (((uint64_t)1 << 27) - 1);
+}
+
+// the samplers take their bits from the engine words themselves, not
+// through a standard library distribution, so a seed gives the same
+// stream with every standard library. the binomial (BTPE) and poisson
+// (PTRS) draws on minstd_rand are pinned to their values here.
+int test_portable_streams(x_random_device *rd)
+{
+	x_seed_seq_from *ssf = seed_seq_from_new_with_callback(rd, (xobj_uint32_callback)fixed_seed_callback);
+	x_seed_seq_from_delegate *ssfd = seed_seq_from_delegate_new(ssf);
+	x_rng *r = rng_minstd_rand_new(ssfd);
+	x_rng *w = rng_minstd_rand_new(ssfd);
+	int failed = 0;
+
+	double u = dist_uniform_real_generate(r, 0., 1.);
+	uint64_t hi = minstd_bits27(w);
+	uint64_t lo = minstd_bits27(w);
+	int ok = u == ((hi << 26) | (lo >> 1)) / 9007199254740992.;
+	printf("uniform_real bits on minstd_rand: %s\n", ok ? "ok" : "WRONG");
+	failed |= !ok;
+
+	long b[4], p[4];
+	const long bk[4] = {38, 30, 22, 36}, pk[4] = {31, 36, 29, 34};
+	dist_binomial_generate_n(r, b, 4, 100, 0.3);
+	dist_poisson_generate_n(r, p, 4, 40.);
+	ok = 1;
+	for(int i = 0; i < 4; i++){
+		ok = ok && b[i] == bk[i] && p[i] == pk[i];
+	}
+	printf("binomial and poisson on minstd_rand: %s\n", ok ? "ok" : "WRONG");
+	failed |= !ok;
+	rng_delete(r);
+	rng_delete(w);
+	seed_seq_from_delegate_delete(ssfd);
+	seed_seq_from_delete(ssf);
+	return failed;
+}
+
+// the sample mean and variance of x against mean and var, within 5
+// standard errors, the variance's worked out from the sample's fourth
+// central moment. a degenerate sample has to match exactly.
+int check_moments(const char *name, const double *x, long count, double mean, double var)
+{
+	double m = 0, m2 = 0, m4 = 0;
+	for(long i = 0; i < count; i++){
+		m += x[i];
+	}
+	m /= count;
+	for(long i = 0; i < count; i++){
+		double d = (x[i] - m) * (x[i] - m);
+		m2 += d;
+		m4 += d * d;
+	}
+	m2 /= count;
+	m4 /= count;
+	int ok = fabs(m - mean) <= 5 * sqrt(var / count)
+		&& fabs(m2 - var) <= 5 * sqrt((m4 - m2 * m2) / count);
+	printf("moments %s: mean %g (%g) var %g (%g) %s\n", name, m, mean, m2, var, ok ? "ok" : "WRONG");
+	return !ok;
+}
+
+// the samplers at the edges of their parameters, through the c api
+int test_moments(x_random_device *rd)
+{
+	x_seed_seq_from *ssf = seed_seq_from_new_with_callback(rd, (xobj_uint32_callback)fixed_seed_callback);
+	x_seed_seq_from_delegate *ssfd = seed_seq_from_delegate_new(ssf);
+	x_rng *r = rng_pcg64_new(ssfd);
+	long count = 1000000;
+	double *x = (double *)malloc(count * sizeof(double));
+	long *k = (long *)malloc(count * sizeof(long));
+	int failed = 0;
+
+	dist_hypergeometric_generate_n(r, k, count, 0, 20, 50);
+	for(long i = 0; i < count; i++){
+		x[i] = k[i];
+	}
+	failed |= check_moments("hypergeometric n = 0", x, count, 0, 0);
+	dist_hypergeometric_generate_n(r, k, count, 30, 0, 50);
+	for(long i = 0; i < count; i++){
+		x[i] = k[i];
+	}
+	failed |= check_moments("hypergeometric M = 0", x, count, 0, 0);
+
+	dist_gamma_generate_n(r, x, count, 0.3, 2.);
+	failed |= check_moments("gamma alpha = 0.3", x, count, 0.3 * 2, 0.3 * 4);
+
+	double a = 0.3, b = 0.5;
+	dist_beta_generate_n(r, x, count, a, b);
+	failed |= check_moments("beta 0.3 0.5", x, count, a / (a + b), a * b / ((a + b) * (a + b) * (a + b + 1)));
+
+	// X > a for X ~ N(0, sigma^2): with s = a / sigma and
+	// h = phi(s) / Q(s), the mean is sigma h and the variance
+	// sigma^2 (1 + s h - h^2)
+	double sa = 7, sigma = 1;
+	double h = sqrt(2 / acos(-1)) * exp(-sa * sa / 2) / erfc(sa / sqrt(2));
+	dist_gaussian_tail_generate_n(r, x, count, sa * sigma, sigma, 1);
+	failed |= check_moments("gaussian_tail a / sigma = 7, table", x, count, sigma * h, sigma * sigma * (1 + sa * h - h * h));
+
+	dist_erlang_generate_n(r, x, count, 200, 2.);
+	failed |= check_moments("erlang k = 200", x, count, 200 / 2., 200 / 4.);
+
+	dist_uniform_int_generate_n(r, k, count, 0, 6);
+	for(long i = 0; i < count; i++){
+		x[i] = k[i];
+	}
+	failed |= check_moments("uniform_int 0 6 on pcg64", x, count, 3, 4);
+
+	free(x);
+	free(k);
+	rng_delete(r);
+	seed_seq_from_delegate_delete(ssfd);
+	seed_seq_from_delete(ssf);
+	return failed;
+}
+
 int main(int argc, char **argv)
 {
 	x_random_device *rd = random_device_new();
@@ -38,6 +371,12 @@ int main(int argc, char **argv)
 		printf("f = %f\n", f);
 	}
 
+	double fbuf[10];
+	dist_gamma_generate_n(r, fbuf, 10, 2., 2.);
+	for(int i = 0; i < 10; i++){
+		printf("f[%d] = %f\n", i, fbuf[i]);
+	}
+
 	int N = 10;
 	for(int i = 0; i < 10; i++){
 		double p[] = {1., 1., 1.};
@@ -57,10 +396,26 @@ int main(int argc, char **argv)
 		printf("------------------------------total = %ld\n", sum);
 	}
 
+	double w[] = {1., 2., 3., 4.};
+	x_dist *d = dist_discrete_new(sizeof(w) / sizeof(double), w);
+	for(int i = 0; i < 10; i++){
+		printf("%ld ", (long)dist_sample(d, r));
+	}
+	printf("\n");
+	dist_delete(d);
+
+	int failed = test_generate_parallel(rd);
+	failed |= test_counter_kat(rd);
+	failed |= test_uniform_int(rd);
+	failed |= test_uniform_bits(rd);
+	failed |= test_portable_streams(rd);
+	failed |= test_moments(rd);
+
 	seed_seq_from_delegate_delete(ssfd);        
 	seed_seq_from_delete(ssf);
 
 	random_device_delete(rd);
 	rng_pcg32_delete(r);
 	//while(1){sleep(1);}
+	return failed;
 }